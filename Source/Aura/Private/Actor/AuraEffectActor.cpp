@@ -6,6 +6,7 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "GAS/AuraAbilitySystemLibrary.h"
 
 
 AAuraEffectActor::AAuraEffectActor()
@@ -101,7 +102,7 @@ void AAuraEffectActor::ItemMovement(float DeltaTime)
  * 并根据 GE 的类型和预设的策略来决定后续行为（例如，是否在效果结束后移除它，或者施加效果后自我销毁）。
  *
  * @par 详细流程
- * 1.  **目标过滤**: 检查目标 Actor 是否带有 "Enemy" 标签。如果带了，并且本效果 Actor 的 `bApplyEffectsToEnemies` 标志为 `false`，则直接中断函数，不对其施加效果。这是一种简单的敌我识别机制。
+ * 1.  **目标过滤**: 检查目标 Actor 是否属于 Enemy 阵营。如果是，并且本效果 Actor 的 `bApplyEffectsToEnemies` 标志为 `false`，则直接中断函数，不对其施加效果。这是一种简单的敌我识别机制。
  * 2.  **获取 ASC**: 尝试从 `TargetActor` 获取其 `AbilitySystemComponent` (ASC)。如果目标没有 ASC，则无法对其施加 GE，函数中断。
  * 3.  **创建并应用 GE**:
  *     - 使用与 `ApplyEffectToSelf` 相同的标准流程：创建 `Context` -> 添加 `SourceObject` -> 创建 `Spec` -> `ApplyGameplayEffectSpecToSelf`。
@@ -121,7 +122,7 @@ void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGam
 	// 步骤 1/5: 过滤目标
 	// (为什么这么做): 这是一个简单的阵营过滤。如果目标是敌人，但这个效果被配置为不影响敌人，则直接返回。
 	// bApplyEffectsToEnemies 是这个效果 Actor 的一个 UPROPERTY(EditAnywhere) 布尔值。
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies ) return; 
+	if(UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies ) return; 
 
 	// 步骤 2/5: 获取目标的 ASC (Ability System Component)
 	// UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent 是获取目标 ASC 的标准静态函数。
@@ -171,7 +172,7 @@ void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGam
  * 此函数专门处理“进入时应用 (`ApplyOnOverlap`)”的策略。
  *
  * @par 详细流程
- * 1.  **目标过滤**: 首先，进行敌我识别。如果进入的 `TargetActor` 有 "Enemy" 标签，
+ * 1.  **目标过滤**: 首先，进行敌我识别。如果进入的 `TargetActor` 属于 Enemy 阵营，
  *     但此效果 Actor 的 `bApplyEffectsToEnemies` 标志为 `false`，则忽略该目标，函数直接返回。
  * 2.  **即时效果检查**: 检查 `InstantEffectApplicationPolicy`（即时效果的应用策略）是否被设置为 `ApplyOnOverlap`。
  *     - 如果是，则调用 `ApplyEffectToTarget` 函数，将 `InstantGameplayEffectClass`（预设的即时 GE）应用到目标身上。
@@ -191,7 +192,7 @@ void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 
 	// 步骤 1/4: 过滤掉不应受影响的目标。
 	// 这是一个简单的敌我识别逻辑，用于增加效果区域的灵活性。
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies ) return; 
+	if(UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies ) return; 
 
 	// 步骤 2/4: 根据“即时效果”的应用策略，决定是否应用效果。
 	// InstantEffectApplicationPolicy 是一个枚举变量，在蓝图中配置。
@@ -248,7 +249,7 @@ void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 void AAuraEffectActor::OnEndOverlap(AActor* TargetActor)
 {
 	// 步骤 1/4: 过滤目标，与 OnOverlap 逻辑一致。
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies ) return; 
+	if(UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies ) return; 
 
 	// 步骤 2/4: 应用那些被配置为“离开时触发”的效果。
 	// 这部分逻辑与 OnOverlap 类似，只是检查的策略是 ApplyOnEndOverlap。
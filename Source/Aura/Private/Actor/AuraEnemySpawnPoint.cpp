@@ -3,7 +3,9 @@
 
 #include "Actor/AuraEnemySpawnPoint.h"
 
+#include "Aura/AuraLogChannels.h"
 #include "Character/EnemyCharacter.h"
+#include "Game/AuraEnemyPool.h"
 
 
 
@@ -24,6 +26,7 @@
  *
  * @par 注意事项
  * - **延迟生成 (Deferred Spawning)** 是本函数的核心。它解决了“先有鸡还是先有蛋”的问题。如果使用常规的 `SpawnActor`，`BeginPlay` 会立即执行，此时你还没有机会设置 `EnemyLevel`，导致 `BeginPlay` 里的逻辑会使用错误的默认等级。延迟生成确保了所有前置数据都已准备就绪后，`BeginPlay` 才会被调用。
+ * - 存在 UAuraEnemyPool 时由回收池完成上述流程（空闲实例优先），下面的直接生成只作为没有回收池时的回退。
  * - `EnemyClass`, `EnemyLevel`, `CharacterClass` 都是 `AAuraEnemySpawnPoint` 上的 `UPROPERTY` 成员变量，必须在蓝图编辑器中为这个生成点的实例正确配置。
  */
 void AAuraEnemySpawnPoint::SpawnEnemy()
@@ -37,8 +40,24 @@ void AAuraEnemySpawnPoint::SpawnEnemy()
 
 	// 步骤 2/5: 开始延迟生成 Actor。
 	// SpawnActorDeferred 会创建一个 Actor 实例，但会暂停其初始化，不会立即调用 BeginPlay。
-	// EnemyClass 是在这个 SpawnPoint 蓝图中设置的、要生成的具体敌人类型。
-	AEnemyCharacter* Enemy = GetWorld()->SpawnActorDeferred<AEnemyCharacter>(EnemyClass, GetActorTransform());
+	// EnemyClass 是在这个 SpawnPoint 蓝图中设置的、要生成的具体敌人类型（软引用，正常情况下已被刷怪区域预加载）。
+	UClass* LoadedEnemyClass = EnemyClass.Get();
+	if (LoadedEnemyClass == nullptr)
+	{
+		// 预加载未完成（或未配置刷怪区域）时回退为同步加载
+		UE_LOG(LogAura, Warning, TEXT("%s: EnemyClass %s was not preloaded, loading synchronously"), *GetName(), *EnemyClass.ToString());
+		LoadedEnemyClass = EnemyClass.LoadSynchronous();
+	}
+	if (LoadedEnemyClass == nullptr) return;
+
+	// 优先从回收池取出死亡后回收的同类敌人（复用 ASC、组件与 AI 控制器，只重新初始化属性和技能）
+	if (UAuraEnemyPool* EnemyPool = UAuraEnemyPool::Get(this))
+	{
+		EnemyPool->AcquireEnemy(LoadedEnemyClass, GetActorTransform(), EnemyLevel, CharacterClass);
+		return;
+	}
+
+	AEnemyCharacter* Enemy = GetWorld()->SpawnActorDeferred<AEnemyCharacter>(LoadedEnemyClass, GetActorTransform());
 	
 	// 步骤 3/5: 在 Actor 完全“激活”前，设置其初始属性。
 	// 这是使用延迟生成的全部意义所在。这些值将在 Enemy 的 BeginPlay 中被访问。
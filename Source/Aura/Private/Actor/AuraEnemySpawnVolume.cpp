@@ -4,8 +4,12 @@
 #include "Actor/AuraEnemySpawnVolume.h"
 
 
+#include "AuraAssetManager.h"
 #include "Actor/AuraEnemySpawnPoint.h"
 #include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Game/AuraEnemySpawnScheduler.h"
+#include "Game/AuraSaveableActorRegistry.h"
 #include "Interation/PlayerInterface.h"
 
 
@@ -31,6 +35,14 @@ AAuraEnemySpawnVolume::AAuraEnemySpawnVolume()
 	// (为什么这么做): 这种“先全部忽略，再单独开启”的设置方式非常安全和明确，
 	// 它确保了这个触发器只会且必须只对 Pawn 产生重叠事件。
 	Box->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+
+	// 预加载范围：同样只对 Pawn 产生重叠，半径在 BeginPlay 中按 PrefetchRadius 设置
+	PrefetchSphere = CreateDefaultSubobject<USphereComponent>(FName("PrefetchSphere"));
+	PrefetchSphere->SetupAttachment(Box);
+	PrefetchSphere->SetCollisionEnabled(ECollisionEnabled::Type::QueryOnly);
+	PrefetchSphere->SetCollisionObjectType(ECC_WorldStatic);
+	PrefetchSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+	PrefetchSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 	
 
 }
@@ -58,7 +70,61 @@ void AAuraEnemySpawnVolume::BeginPlay()
 	// 动态地将本类的 OnBoxOverlap 函数绑定到 Box 组件的 OnComponentBeginOverlap 委托上。
 	// 当有物体进入 Box 的范围并满足碰撞响应设置时，OnBoxOverlap 函数就会被自动调用。
 	Box->OnComponentBeginOverlap.AddDynamic(this, &AAuraEnemySpawnVolume::OnBoxOverlap);
-	
+
+	// 预加载范围（客户端同样执行：敌人复制过来时类已在内存中，不会在网络包处理中同步加载）
+	PrefetchSphere->SetSphereRadius(PrefetchRadius);
+	PrefetchSphere->OnComponentBeginOverlap.AddDynamic(this, &AAuraEnemySpawnVolume::OnPrefetchSphereOverlap);
+}
+
+void AAuraEnemySpawnVolume::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	if (UAuraSaveableActorRegistry* Registry = UAuraSaveableActorRegistry::Get(this))
+	{
+		Registry->RegisterSaveableActor(this);
+	}
+}
+
+void AAuraEnemySpawnVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraSaveableActorRegistry* Registry = UAuraSaveableActorRegistry::Get(this))
+	{
+		Registry->UnregisterSaveableActor(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAuraEnemySpawnVolume::OnPrefetchSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	if (!OtherActor->Implements<UPlayerInterface>()) return;
+
+	StartPrefetch();
+	// 预加载只需触发一次
+	PrefetchSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+/**
+ * @brief 通过 UAuraAssetManager 异步加载所有生成点的敌人类
+ *
+ * 注意事项：
+ * - 敌人类的硬引用依赖（网格、动画蓝图、行为树、Niagara 等）随类一起加载；
+ * - 职业的默认能力/属性 GE 由 UCharacterClassInfo 以硬引用持有，游戏模式加载时已常驻，这里不再重复请求。
+ */
+void AAuraEnemySpawnVolume::StartPrefetch()
+{
+	if (PrefetchHandle.IsValid()) return;
+
+	TArray<FSoftObjectPath> EnemyClassPaths;
+	EnemyClassPaths.Reserve(SpawnPoints.Num());
+	for (const AAuraEnemySpawnPoint* Point : SpawnPoints)
+	{
+		if (IsValid(Point) && !Point->EnemyClass.IsNull())
+		{
+			EnemyClassPaths.AddUnique(Point->EnemyClass.ToSoftObjectPath());
+		}
+	}
+	PrefetchHandle = UAuraAssetManager::Get().PreloadEnemyClasses(MoveTemp(EnemyClassPaths));
 }
 
 
@@ -75,21 +141,54 @@ void AAuraEnemySpawnVolume::OnBoxOverlap(UPrimitiveComponent* OverlappedComponen
 	// 步骤 2/4: 标记此触发器已被激活。
 	// 这个状态将被保存，以便在 LoadActor_Implementation 中使用。
 	bReached = true;
+	MarkSaveDirty();
 
 	// 步骤 3/4: 激活所有关联的生成点。
-	// SpawnPoints 是一个 UPROPERTY 的 TArray<AAuraEnemySpawnPoint*>，在蓝图编辑器中指定。
-	for (AAuraEnemySpawnPoint* Point : SpawnPoints)
+	// 若预加载尚未完成（玩家直接进入了触发区域），等加载完成后再入队，避免生成时同步读盘。
+	StartPrefetch();
+	const FVector PlayerLocation = OtherActor->GetActorLocation();
+	if (PrefetchHandle.IsValid() && PrefetchHandle->IsLoadingInProgress())
 	{
-		// 安全检查，防止数组中包含了无效的或已被销毁的生成点。
-		if (IsValid(Point))
+		TWeakObjectPtr<AAuraEnemySpawnVolume> WeakThis(this);
+		PrefetchHandle->BindCompleteDelegate(FStreamableDelegate::CreateLambda([WeakThis, PlayerLocation]()
 		{
-			Point->SpawnEnemy();// 命令每个生成点生成它的敌人。
-		}
+			if (WeakThis.IsValid())
+			{
+				WeakThis->QueueSpawns(PlayerLocation);
+			}
+		}));
+	}
+	else
+	{
+		QueueSpawns(PlayerLocation);
 	}
 	// 步骤 4/4: 禁用触发器，使其成为一次性事件。
 	// 刷怪完成后，立即禁用 Box 的碰撞，防止玩家离开再进入时重复刷怪。
 	Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
+/**
+ * @brief 把所有生成点交给分帧调度器
+ *
+ * (为什么这么做): 同一帧生成十几个敌人（控制器、行为树、属性 GE）会造成明显卡顿，
+ * 因此交给分帧调度器，按离玩家由近到远在每帧预算内逐个生成。
+ */
+void AAuraEnemySpawnVolume::QueueSpawns(const FVector& PlayerLocation)
+{
+	UAuraEnemySpawnScheduler* SpawnScheduler = UAuraEnemySpawnScheduler::Get(this);
+	// SpawnPoints 是一个 UPROPERTY 的 TArray<AAuraEnemySpawnPoint*>，在蓝图编辑器中指定。
+	for (AAuraEnemySpawnPoint* Point : SpawnPoints)
+	{
+		// 安全检查，防止数组中包含了无效的或已被销毁的生成点。
+		if (!IsValid(Point)) continue;
 
-
+		if (SpawnScheduler)
+		{
+			SpawnScheduler->QueueSpawn(Point, PlayerLocation);
+		}
+		else
+		{
+			Point->SpawnEnemy();// 没有调度器时直接生成。
+		}
+	}
+}
@@ -9,12 +9,19 @@
 #include "GameplayCueManager.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 
-void AAuraFireBall::BeginPlay()
+void AAuraFireBall::OnProjectileActivated()
 {
-	Super::BeginPlay();
+	Super::OnProjectileActivated();
 	StartOutgoingTimeline();
 }
 
+void AAuraFireBall::OnProjectileDeactivated()
+{
+	Super::OnProjectileDeactivated();
+	ReturnToActor = nullptr;
+	ExplosionDamageParams = FDamageEffectParams();
+}
+
 /**
  * @brief 处理火球与其它 Actor 发生重叠时的核心逻辑，主要负责在服务器上施加伤害。
  *
@@ -88,12 +95,12 @@ void AAuraFireBall::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent,
  *     - 检查火球的 `Owner`（发射者）是否存在。
  *     - 如果存在，则在火球当前的位置触发一个 GameplayCue (GC - 游戏逻辑提示)。GC 是 GAS 中专门用于处理装饰性、非关键逻辑（如粒子特效、音效）的系统。
  *     - 这里使用了 `ExecuteGameplayCue_NonReplicated`，意味着这个 GC 只会在调用它的机器上本地播放，不会自动同步到其他客户端。
- * 2.  **清理循环音效**：检查是否存在 `LoopingSoundComponent`（火球飞行时的持续音效），如果存在，则停止播放并销毁该组件，防止声音在火球消失后继续存在。
+ * 2.  **停止循环音效**：检查是否存在 `LoopingSoundComponent`（火球飞行时的持续音效），如果存在，则停止播放（组件保留，供对象池复用时重新播放）。
  * 3.  **设置命中状态**：将布尔变量 `bHit` 设为 `true`。这是一个状态锁，用于防止例如在穿透多个目标或快速连续重叠时，重复执行命中逻辑。
  *
  * @par 注意事项
  * - `ExecuteGameplayCue_NonReplicated` 的使用需要特别注意。如果 `OnHit()` 只在服务器上被调用，那么爆炸特效将只在服务器上播放，客户端是看不到的。通常需要配合一个 NetMulticast RPC 来在所有客户端上调用 `OnHit()`，或者使用一个配置为可复制的 GameplayCue Tag。
- * - 资源清理（如销毁声音组件）是一个好习惯，可以防止内存和性能泄漏。
+ * - 循环音效组件只停止不销毁，由对象池复用时重新播放。
  */
 void AAuraFireBall::OnHit()
 {
@@ -114,12 +121,11 @@ void AAuraFireBall::OnHit()
 		);
 	}
 
-	// 步骤 2/3: 清理飞行中的循环音效
+	// 步骤 2/3: 停止飞行中的循环音效
 	// 如果火球带有一个循环播放的音效组件（例如飞行的“咻咻”声）...
 	if (LoopingSoundComponent)
 	{
-		LoopingSoundComponent->Stop(); // ...立即停止播放。
-		LoopingSoundComponent->DestroyComponent();// ...并销毁该组件，释放资源。
+		LoopingSoundComponent->Stop(); // ...立即停止播放（组件保留给对象池复用）。
 	}
 
 	// 步骤 3/3: 设置状态锁，防止重复触发
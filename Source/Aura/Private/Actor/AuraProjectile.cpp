@@ -9,9 +9,11 @@
 #include "Aura/Aura.h"
 #include "Components/AudioComponent.h"
 #include "Components/SphereComponent.h"
-#include "GameFramework/ProjectileMovementComponent.h"
+#include "Game/AuraProjectilePool.h"
+#include "Actor/AuraProjectileMovementComponent.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
 
 
 AAuraProjectile::AAuraProjectile()
@@ -26,7 +28,7 @@ AAuraProjectile::AAuraProjectile()
 	Sphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
 	Sphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Overlap);
 	Sphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>("ProjectileMovement");
+	ProjectileMovement = CreateDefaultSubobject<UAuraProjectileMovementComponent>("ProjectileMovement");
 	ProjectileMovement->InitialSpeed = 550.F;
 	ProjectileMovement->MaxSpeed = 550.F;
 	ProjectileMovement->ProjectileGravityScale = 0.F;
@@ -35,15 +37,173 @@ AAuraProjectile::AAuraProjectile()
 }
 
 
+void AAuraProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AAuraProjectile, bPoolActive);
+}
+
 void AAuraProjectile::BeginPlay()
 {
 	Super::BeginPlay();
 	SetReplicateMovement(true);
-	SetLifeSpan(LifeSpan);
-	LoopingSoundComponent = UGameplayStatics::SpawnSoundAttached(LoopingSound,GetRootComponent());
-	//在组件开始重叠时，执行OnSphereOverlap
+	//在组件开始重叠时，执行OnSphereOverlap（只绑定一次，对象池复用时不再重复绑定）
 	Sphere->OnComponentBeginOverlap.AddDynamic(this,&AAuraProjectile::OnSphereOverlap);
-	
+
+	// 预热的池内实例以停用状态开始
+	bLocallyActive = bPoolActive;
+	if (bPoolActive)
+	{
+		OnProjectileActivated();
+	}
+	else
+	{
+		OnProjectileDeactivated();
+	}
+}
+
+/**
+ * @brief 进入激活状态
+ *
+ * 注意事项：
+ * - 首次激活发生在 BeginPlay 中，移动组件已由 InitializeComponent 初始化；
+ *   复用时（已 BeginPlay）需要重新绑定 UpdatedComponent 并按当前朝向重置速度。
+ * - 循环音效组件只创建一次（不自动销毁），之后复用时重新 Play。
+ */
+void AAuraProjectile::OnProjectileActivated()
+{
+	bHit = false;
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (HasActorBegunPlay())
+	{
+		ProjectileMovement->SetUpdatedComponent(GetRootComponent());
+		ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+		ProjectileMovement->SetComponentTickEnabled(true);
+	}
+
+	if (HasAuthority())
+	{
+		SetLifeSpan(LifeSpan);
+	}
+
+	if (LoopingSoundComponent)
+	{
+		LoopingSoundComponent->Play();
+	}
+	else if (LoopingSound)
+	{
+		LoopingSoundComponent = UGameplayStatics::SpawnSoundAttached(LoopingSound, GetRootComponent(), NAME_None, FVector(ForceInit),
+			EAttachLocation::KeepRelativeOffset, false, 1.f, 1.f, 0.f, nullptr, nullptr, false);
+	}
+}
+
+void AAuraProjectile::OnProjectileDeactivated()
+{
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	ProjectileMovement->StopMovementImmediately();
+	ProjectileMovement->SetComponentTickEnabled(false);
+	ProjectileMovement->ClearHomingTarget();
+
+	if (LoopingSoundComponent)
+	{
+		LoopingSoundComponent->Stop();
+	}
+
+	if (HasAuthority())
+	{
+		SetLifeSpan(0.f);
+	}
+
+	// 释放对上一次施法者 ASC 等对象的引用
+	DamageEffectParams = FDamageEffectParams();
+}
+
+void AAuraProjectile::SetLocallyActive(bool bActive)
+{
+	if (bLocallyActive == bActive) return;
+	bLocallyActive = bActive;
+	if (bActive)
+	{
+		OnProjectileActivated();
+	}
+	else
+	{
+		OnProjectileDeactivated();
+	}
+}
+
+void AAuraProjectile::OnRep_PoolActive()
+{
+	// BeginPlay 会按当前值初始化
+	if (!HasActorBegunPlay()) return;
+
+	// 与 Destroyed 中一致：客户端未本地命中时，回收前补播命中表现
+	if (!bPoolActive && bLocallyActive && !bHit) OnHit();
+	SetLocallyActive(bPoolActive);
+}
+
+void AAuraProjectile::InitPooled(bool bStartActive)
+{
+	bPooled = true;
+	bPoolActive = bStartActive;
+	if (!bStartActive)
+	{
+		// 预热实例不需要同步给客户端，直到第一次激活
+		NetDormancy = DORM_DormantAll;
+	}
+}
+
+void AAuraProjectile::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	SetNetDormancy(DORM_Awake);
+	SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+	bPoolActive = true;
+	SetLocallyActive(true);
+	ForceNetUpdate();
+}
+
+void AAuraProjectile::DeactivateForPool()
+{
+	bPoolActive = false;
+	SetLocallyActive(false);
+	// 停用状态会在进入休眠前最后同步一次
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void AAuraProjectile::ReturnToPool()
+{
+	if (!HasAuthority()) return;
+	if (!bPooled)
+	{
+		Destroy();
+		return;
+	}
+	// 已回收（同一帧内多次命中）
+	if (!bPoolActive) return;
+
+	if (UAuraProjectilePool* Pool = UAuraProjectilePool::Get(this))
+	{
+		Pool->ReleaseProjectile(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void AAuraProjectile::LifeSpanExpired()
+{
+	if (bPooled && HasAuthority())
+	{
+		ReturnToPool();
+		return;
+	}
+	Super::LifeSpanExpired();
 }
 
 void AAuraProjectile::OnHit()
@@ -51,10 +211,10 @@ void AAuraProjectile::OnHit()
 	// 在投射物被销毁时播放音效（ImpactSound）和位置特效（ImpactEffect）
 	UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation(),FRotator::ZeroRotator);
 	UNiagaraFunctionLibrary::SpawnSystemAtLocation(this,ImpactEffect,GetActorLocation());
+	// 只停止不销毁：对象池复用时重新播放
 	if (LoopingSoundComponent)
 	{
 		LoopingSoundComponent->Stop();
-		LoopingSoundComponent->DestroyComponent();
 	}
 	
 	bHit = true;
@@ -67,8 +227,8 @@ void AAuraProjectile::Destroyed()
 		LoopingSoundComponent->Stop();
 		LoopingSoundComponent->DestroyComponent();
 	}
-	// 如果投射物未命中目标（bHit 为 false）且当前没有服务器权限（客户端）
-	if (!bHit && !HasAuthority())OnHit();
+	// 如果投射物未命中目标（bHit 为 false）且当前没有服务器权限（客户端）；已回收的池内实例不再播放
+	if (bLocallyActive && !bHit && !HasAuthority())OnHit();
 
 	// 调用父类的销毁逻辑，确保基础行为被执行
 	Super::Destroyed();
@@ -138,8 +298,8 @@ void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent,
 			UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams); // 应用伤害GE
 		}
 
-		// 服务器销毁投射物（延迟到安全时机执行）
-		Destroy();
+		// 服务器回收投射物（未使用对象池时销毁）
+		ReturnToPool();
 	}
 	else
 	{
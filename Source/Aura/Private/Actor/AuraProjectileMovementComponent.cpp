@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Actor/AuraProjectileMovementComponent.h"
+
+void UAuraProjectileMovementComponent::SetHomingTargetLocation(const FVector& InTargetLocation)
+{
+	HomingTargetComponent = nullptr;
+	HomingTargetLocation = InTargetLocation;
+	bHasHomingTargetLocation = true;
+}
+
+void UAuraProjectileMovementComponent::ClearHomingTarget()
+{
+	HomingTargetComponent = nullptr;
+	bHasHomingTargetLocation = false;
+}
+
+/**
+ * @brief 在父类加速度（重力/外力/组件跟踪）的基础上，叠加朝目标坐标的跟踪加速度
+ *
+ * 注意事项：
+ * - 仅在没有有效跟踪组件时使用坐标，避免与父类的组件跟踪重复叠加。
+ */
+FVector UAuraProjectileMovementComponent::ComputeAcceleration(const FVector& InVelocity, float DeltaTime) const
+{
+	FVector Acceleration = Super::ComputeAcceleration(InVelocity, DeltaTime);
+
+	if (bIsHomingProjectile && bHasHomingTargetLocation && !HomingTargetComponent.IsValid() && UpdatedComponent)
+	{
+		Acceleration += (HomingTargetLocation - UpdatedComponent->GetComponentLocation()).GetSafeNormal() * HomingAccelerationMagnitude;
+	}
+	return Acceleration;
+}
@@ -1,4 +1,138 @@
 #include "AuraAbilityTypes.h"
+
+#include "AuraGamePlayTags.h"
+#include "Aura/AuraLogChannels.h"
+#include "GAS/AuraAbilitySystemGlobals.h"
+#include "Containers/LockFreeList.h"
+#include "Engine/NetSerialization.h"
+#include "Serialization/BitWriter.h"
+
+DECLARE_STATS_GROUP(TEXT("AuraEffectContext"), STATGROUP_AuraEffectContext, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Allocations"), STAT_AuraEffectContext_Allocations, STATGROUP_AuraEffectContext);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses (Heap)"), STAT_AuraEffectContext_PoolMisses, STATGROUP_AuraEffectContext);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Contexts"), STAT_AuraEffectContext_Live, STATGROUP_AuraEffectContext);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Blocks"), STAT_AuraEffectContext_Pooled, STATGROUP_AuraEffectContext);
+
+namespace AuraEffectContextPool
+{
+	// 每个内存块的大小与对齐（与 FAuraGameplayEffectContext 一致）
+	constexpr SIZE_T BlockSize = sizeof(FAuraGameplayEffectContext);
+	constexpr uint32 BlockAlignment = alignof(FAuraGameplayEffectContext);
+
+	// 无锁空闲链表：刻意不析构（进程退出时仍可能有 Context 存活并在静态析构后释放）
+	static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE>& GetFreeList()
+	{
+		static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE>* FreeList = new TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE>();
+		return *FreeList;
+	}
+}
+
+namespace AuraEffectContextNetQuantize
+{
+	// RepBits 位数：最高位为 bit19（RadialDamageOrigin）
+	constexpr int32 NumRepBits = 20;
+
+	// 伤害类型稠密索引位数；全 1 表示“表外 Tag，回退为完整 Tag 序列化”
+	constexpr uint32 DamageTypeIndexBits = 3;
+	constexpr uint32 DamageTypeFallbackIndex = (1u << DamageTypeIndexBits) - 1;
+	static_assert(EAuraDamageTypeIndex::Num < DamageTypeFallbackIndex, "DamageTypeIndexBits is too small for EAuraDamageTypeIndex");
+
+	/**
+	 * @brief 以定点方式读写 [0, MaxValue] 范围内的 float
+	 *
+	 * 注意事项：
+	 * - 先写 1 位“完整 float”标记：值超出 [0, MaxValue]（或为 NaN、MaxValue 配置无效）时记录警告并发送完整 float，不做截断；
+	 * - MaxValue 来自 UAuraAbilitySystemGlobals 的 Config，读写两端必须一致。
+	 */
+	static void SerializeQuantizedFloat(FArchive& Ar, float& Value, float MaxValue, uint32 NumBits, const TCHAR* FieldName)
+	{
+		uint8 bFullFloat = 0;
+		if (Ar.IsSaving())
+		{
+			bFullFloat = !(MaxValue > 0.f && Value >= 0.f && Value <= MaxValue);
+			if (bFullFloat)
+			{
+				UE_LOG(LogAura, Warning, TEXT("EffectContext %s = %f is outside the quantized range [0, %f]; sending a full float."), FieldName, Value, MaxValue);
+			}
+		}
+		Ar.SerializeBits(&bFullFloat, 1);
+		if (bFullFloat)
+		{
+			Ar << Value;
+			return;
+		}
+
+		const uint32 MaxQuantized = (1u << NumBits) - 1;
+		uint32 Quantized = 0;
+		if (Ar.IsSaving())
+		{
+			Quantized = static_cast<uint32>(FMath::RoundToInt(Value / MaxValue * MaxQuantized));
+		}
+		Ar.SerializeBits(&Quantized, NumBits);
+		if (Ar.IsLoading())
+		{
+			Value = static_cast<float>(Quantized) * MaxValue / MaxQuantized;
+		}
+	}
+}
+
+/**
+ * @brief 类级 operator new：优先从空闲链表取块，池空时回退到 FMemory::Malloc
+ *
+ * 注意事项：
+ * - 若派生类尺寸与本类不同（Size != BlockSize），直接走通用堆，不进入池；
+ * - 块只会回到池中而不会归还给堆，池大小即历史峰值存活数量。
+ */
+void* FAuraGameplayEffectContext::operator new(size_t Size)
+{
+	if (Size != AuraEffectContextPool::BlockSize)
+	{
+		return FMemory::Malloc(Size, AuraEffectContextPool::BlockAlignment);
+	}
+
+	INC_DWORD_STAT(STAT_AuraEffectContext_Allocations);
+	INC_DWORD_STAT(STAT_AuraEffectContext_Live);
+
+	if (void* Block = AuraEffectContextPool::GetFreeList().Pop())
+	{
+		DEC_DWORD_STAT(STAT_AuraEffectContext_Pooled);
+		return Block;
+	}
+
+	INC_DWORD_STAT(STAT_AuraEffectContext_PoolMisses);
+	return FMemory::Malloc(AuraEffectContextPool::BlockSize, AuraEffectContextPool::BlockAlignment);
+}
+
+/**
+ * @brief 类级 operator delete：把块压回空闲链表以供复用
+ */
+void FAuraGameplayEffectContext::operator delete(void* Ptr, size_t Size)
+{
+	if (Ptr == nullptr) return;
+	if (Size != AuraEffectContextPool::BlockSize)
+	{
+		FMemory::Free(Ptr);
+		return;
+	}
+
+	DEC_DWORD_STAT(STAT_AuraEffectContext_Live);
+	INC_DWORD_STAT(STAT_AuraEffectContext_Pooled);
+	AuraEffectContextPool::GetFreeList().Push(Ptr);
+}
+
+/**
+ * @brief 预热内存池：一次性分配 NumContexts 个块放入空闲链表
+ * @param NumContexts 预分配数量（应覆盖单帧峰值命中数，如大范围 AoE）
+ */
+void FAuraGameplayEffectContext::ReservePool(int32 NumContexts)
+{
+	for (int32 Index = 0; Index < NumContexts; ++Index)
+	{
+		INC_DWORD_STAT(STAT_AuraEffectContext_Pooled);
+		AuraEffectContextPool::GetFreeList().Push(FMemory::Malloc(AuraEffectContextPool::BlockSize, AuraEffectContextPool::BlockAlignment));
+	}
+}
+
 /**
  * @brief 自定义 FAuraGameplayEffectContext 的网络序列化函数
  * @param Ar         网络读写通道（Saving = 写出到网络包；Loading = 从网络包读入）
@@ -28,27 +162,33 @@
  *      - bit4: Actors 数组（附加的目标集合）
  *      - bit5: HitResult（命中信息）
  *      - bit6: bHasWorldOrigin（世界坐标）
- *      - bit7: bIsBlockedHit（是否格挡命中）
- *      - bit8: bIsCriticalHit（是否暴击）
- *      - bit9: bIsSuccessfulDebuff（减益是否成功）
- *      - bit10: DebuffDamage（减益伤害）
- *      - bit11: DebuffDuration（减益持续时间）
- *      - bit12: DebuffFrequency（减益频率）
- *      - bit13: DamageType（伤害类型 Tag）
- *   3. 写出 RepBits（⚠ 注意位数必须覆盖最高位）。
+ *      - bit7: bIsBlockedHit（是否格挡命中，位本身即值）
+ *      - bit8: bIsCriticalHit（是否暴击，位本身即值）
+ *      - bit9: bIsSuccessfulDebuff（减益是否成功，位本身即值）
+ *      - bit10: DebuffDamage（减益伤害，量化）
+ *      - bit11: DebuffDuration（减益持续时间，量化）
+ *      - bit12: DebuffFrequency（减益频率，量化）
+ *      - bit13: DamageType（伤害类型 Tag，稠密索引）
+ *      - bit14: DeathImpulse（死亡冲量，0.1 精度打包向量）
+ *      - bit15: KnockBackForce（击退力，0.1 精度打包向量）
+ *      - bit16: bIsRadialDamage（径向伤害，位本身即值）
+ *      - bit17: RadialDamageInnerRadius（量化）
+ *      - bit18: RadialDamageOuterRadius（量化）
+ *      - bit19: RadialDamageOrigin（0.1 精度打包向量）
+ *   3. 写出 RepBits（共 NumRepBits = 20 位）。
  *   4. 按位逐个写出实际数据。
  *
  * 【Loading 路径】
  *   1. 读取 RepBits。
- *   2. 按位逐个加载对应字段（必要时动态分配，例如 HitResult、DamageType）。
- *   3. 对 bHasWorldOrigin 之外的未置位字段，保持默认值（注意可能会残留旧值）。
+ *   2. 按位逐个加载对应字段（必要时动态分配，例如 HitResult）。
+ *   3. Aura 扩展字段未置位时重置为默认值，避免复用的 Context 残留旧值。
  *   4. 调用 AddInstigator() 补回施加者与效果来源的引用关系。
  *   5. 标记 bOutSuccess = true，返回 true。
  *
  * 注意事项：
- * - 位数要与置位的最高位一致，否则高位字段会被截断。
- * - “非零才复制”的 float 字段（DebuffDamage 等）可能导致清零不同步的问题。
- * - Loading 时未置位的字段不清理可能导致旧数据残留，建议必要时手动清理。
+ * - 量化位数见 AuraEffectContextNetQuantize，范围上限读自 UAuraAbilitySystemGlobals 的 Config；超出范围的值以完整 float 发送；
+ * - 伤害类型若不在稠密表中（EAuraDamageTypeIndex），回退为 FGameplayTag::NetSerialize；
+ * - 可用控制台命令 "Aura.Debug.EffectContextNetSize" 输出典型 Context 的线上位数。
  */
 
 bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
@@ -138,7 +278,7 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* M
 		}
 
 		// DamageType（FGameplayTag）有效才传，对应第13位
-		if (DamageType)
+		if (DamageType.IsValid())
 		{
 			RepBits |= 1 << 13;
 		}
@@ -161,15 +301,15 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* M
 			{
 				RepBits |= 1 << 18;
 			}
-			if (RadialDamageOrigin.IsZero())
+			if (!RadialDamageOrigin.IsZero())
 			{
 				RepBits |= 1 << 19;
 			}
 		}
 	}
 
-	// 把 RepBits 自己写/读一下，让双方都知道“哪些字段会被同步”
-	Ar.SerializeBits(&RepBits, 19);
+	// 把 RepBits 自己写/读一下，让双方都知道“哪些字段会被同步”（位数必须覆盖最高位 bit19）
+	Ar.SerializeBits(&RepBits, AuraEffectContextNetQuantize::NumRepBits);
 
 	// 如果第0位为1：同步 Instigator
 	if (RepBits & (1 << 0))
@@ -226,80 +366,100 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* M
 	{
 		bHasWorldOrigin = false;
 	}
-	
-	// 第7位：同步 bIsBlockedHit
-	if (RepBits & (1 << 7))
-	{
-		Ar << bIsBlockedHit;
-	}
-	
-	// 第8位：同步 bIsCriticalHit
-	if (RepBits & (1 << 8))
-	{
-		Ar << bIsCriticalHit;
-	}
 
-	// 第9位：同步 bIsSuccessfulDebuff
-	if (RepBits & (1 << 9))
+	// 以下为 Aura 扩展字段：读入时以 RepBits 为准，未置位即恢复默认值
+	if (Ar.IsLoading())
 	{
-		Ar << bIsSuccessfulDebuff;
+		// 第7~9位、第16位：布尔值直接由位图携带，无需额外负载
+		bIsBlockedHit = (RepBits & (1 << 7)) != 0;
+		bIsCriticalHit = (RepBits & (1 << 8)) != 0;
+		bIsSuccessfulDebuff = (RepBits & (1 << 9)) != 0;
+		bIsRadialDamage = (RepBits & (1 << 16)) != 0;
+
+		DebuffDamage = 0.f;
+		DebuffDuration = 0.f;
+		DebuffFrequency = 0.f;
+		DamageType = FGameplayTag();
+		DeathImpulse = FVector::ZeroVector;
+		KnockBackForce = FVector::ZeroVector;
+		RadialDamageInnerRadius = 0.f;
+		RadialDamageOuterRadius = 0.f;
+		RadialDamageOrigin = FVector::ZeroVector;
 	}
 
-	// 第10位：同步 DebuffDamage（float）
+	// 量化范围上限（Config，两端读取同一份配置）
+	const UAuraAbilitySystemGlobals* Globals = GetDefault<UAuraAbilitySystemGlobals>();
+
+	// 第10位：同步 DebuffDamage（量化 float）
 	if (RepBits & (1 << 10))
 	{
-		Ar << DebuffDamage;
+		AuraEffectContextNetQuantize::SerializeQuantizedFloat(Ar, DebuffDamage, Globals->EffectContextDebuffDamageMax, AuraEffectContextNetQuantize::DebuffDamageBits, TEXT("DebuffDamage"));
 	}
 
-	// 第11位：同步 DebuffDuration（float）
+	// 第11位：同步 DebuffDuration（量化 float）
 	if (RepBits & (1 << 11))
 	{
-		Ar << DebuffDuration;
+		AuraEffectContextNetQuantize::SerializeQuantizedFloat(Ar, DebuffDuration, Globals->EffectContextDebuffDurationMax, AuraEffectContextNetQuantize::DebuffDurationBits, TEXT("DebuffDuration"));
 	}
 
-	// 第12位：同步 DebuffFrequency（float）
+	// 第12位：同步 DebuffFrequency（量化 float）
 	if (RepBits & (1 << 12))
 	{
-		Ar << DebuffFrequency;
+		AuraEffectContextNetQuantize::SerializeQuantizedFloat(Ar, DebuffFrequency, Globals->EffectContextDebuffFrequencyMax, AuraEffectContextNetQuantize::DebuffFrequencyBits, TEXT("DebuffFrequency"));
 	}
 
-	// 第13位：同步 DamageType（FGameplayTag；用 TSharedPtr 持有，需要先确保有对象）
+	// 第13位：同步 DamageType（优先写稠密索引，表外 Tag 回退为 Tag 自身的 NetSerialize）
 	if (RepBits & (1 << 13))
 	{
-		// 读入时如果还没对象，就 new 一个
-		if (Ar.IsLoading())
+		const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+		uint32 DamageTypeIndex = AuraEffectContextNetQuantize::DamageTypeFallbackIndex;
+		if (Ar.IsSaving())
+		{
+			const int32 DenseIndex = GamePlayTags.GetDamageTypeIndex(DamageType);
+			if (DenseIndex != INDEX_NONE)
+			{
+				DamageTypeIndex = static_cast<uint32>(DenseIndex);
+			}
+		}
+		Ar.SerializeBits(&DamageTypeIndex, AuraEffectContextNetQuantize::DamageTypeIndexBits);
+
+		if (DamageTypeIndex < EAuraDamageTypeIndex::Num)
 		{
-			if (!DamageType.IsValid())
+			if (Ar.IsLoading())
 			{
-				DamageType = TSharedPtr<FGameplayTag>(new FGameplayTag());
+				DamageType = GamePlayTags.DamageTypeInfos[DamageTypeIndex].DamageType;
 			}
 		}
-		// 调用 Tag 自己的 NetSerialize
-		DamageType->NetSerialize(Ar, Map, bOutSuccess);
+		else
+		{
+			DamageType.NetSerialize(Ar, Map, bOutSuccess);
+		}
 	}
+
+	// 第14位：同步 DeathImpulse（FVector_NetQuantize10 同款打包）
 	if (RepBits & (1 << 14))
 	{
-		DeathImpulse.NetSerialize(Ar, Map, bOutSuccess);
+		SerializePackedVector<10, 24>(DeathImpulse, Ar);
 	}
+
+	// 第15位：同步 KnockBackForce（FVector_NetQuantize10 同款打包）
 	if (RepBits & (1 << 15))
 	{
-		KnockBackForce.NetSerialize(Ar, Map, bOutSuccess);
+		SerializePackedVector<10, 24>(KnockBackForce, Ar);
 	}
-	if (RepBits & (1 << 16))
+
+	// 第16位仅作为 bIsRadialDamage 的值；第17~19位只在径向伤害时才可能置位
+	if (RepBits & (1 << 17))
 	{
-		Ar <<bIsRadialDamage;
-		if (RepBits & (1 << 17))
-		{
-			Ar << RadialDamageInnerRadius;
-		}
-		if (RepBits & (1 << 18))
-		{
-			Ar << RadialDamageOuterRadius;
-		}
-		if (RepBits & (1 << 19))
-		{
-			RadialDamageOrigin.NetSerialize(Ar, Map, bOutSuccess);
-		}
+		AuraEffectContextNetQuantize::SerializeQuantizedFloat(Ar, RadialDamageInnerRadius, Globals->EffectContextRadialDamageRadiusMax, AuraEffectContextNetQuantize::RadialDamageRadiusBits, TEXT("RadialDamageInnerRadius"));
+	}
+	if (RepBits & (1 << 18))
+	{
+		AuraEffectContextNetQuantize::SerializeQuantizedFloat(Ar, RadialDamageOuterRadius, Globals->EffectContextRadialDamageRadiusMax, AuraEffectContextNetQuantize::RadialDamageRadiusBits, TEXT("RadialDamageOuterRadius"));
+	}
+	if (RepBits & (1 << 19))
+	{
+		SerializePackedVector<10, 24>(RadialDamageOrigin, Ar);
 	}
 	
 	// 如果是“读入完成”，把 Instigator/EffectCauser 的关系补回 Context 内部
@@ -312,3 +472,53 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* M
 	bOutSuccess = true;
 	return true;
 }
+
+#if !UE_BUILD_SHIPPING
+/**
+ * @brief 控制台命令：输出几种典型 Context 序列化后的线上位数（不含对象引用，无需 PackageMap）
+ *
+ * 用法：Aura.Debug.EffectContextNetSize
+ */
+static FAutoConsoleCommand CVarAuraEffectContextNetSize(
+	TEXT("Aura.Debug.EffectContextNetSize"),
+	TEXT("Logs the bytes-on-the-wire of representative FAuraGameplayEffectContext payloads."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+
+		auto MeasureBits = [](FAuraGameplayEffectContext& Context) -> int64
+		{
+			FBitWriter Writer(0, true);
+			bool bSuccess = false;
+			Context.NetSerialize(Writer, nullptr, bSuccess);
+			return Writer.GetNumBits();
+		};
+
+		// 1) 普通单体命中：暴击 + 伤害类型 + 死亡冲量/击退
+		FAuraGameplayEffectContext HitContext;
+		HitContext.SetIsCriticalHit(true);
+		HitContext.SetDamageType(GamePlayTags.Damage_Fire);
+		HitContext.SetDeathImpulse(FVector(3000.f, 1200.f, 500.f));
+		HitContext.SetKnockBackForce(FVector(600.f, 240.f, 200.f));
+
+		// 2) 触发 Debuff 的命中：额外携带 Debuff 三个参数
+		FAuraGameplayEffectContext DebuffContext = HitContext;
+		DebuffContext.SetIsSuccessfulDebuff(true);
+		DebuffContext.SetDebuffDamage(5.f);
+		DebuffContext.SetDebuffDuration(5.f);
+		DebuffContext.SetDebuffFrequency(1.f);
+
+		// 3) 径向伤害命中：额外携带内外半径与原点
+		FAuraGameplayEffectContext RadialContext = HitContext;
+		RadialContext.SetIsRadialDamage(true);
+		RadialContext.SetRadialDamageInnerRadius(50.f);
+		RadialContext.SetRadialDamageOuterRadius(300.f);
+		RadialContext.SetRadialDamageOrigin(FVector(1520.3f, -840.7f, 92.15f));
+
+		const int64 HitBits = MeasureBits(HitContext);
+		const int64 DebuffBits = MeasureBits(DebuffContext);
+		const int64 RadialBits = MeasureBits(RadialContext);
+		UE_LOG(LogAura, Log, TEXT("EffectContext NetSize: Hit=%lld bits (%lld bytes), Debuff=%lld bits (%lld bytes), Radial=%lld bits (%lld bytes)"),
+			HitBits, (HitBits + 7) / 8, DebuffBits, (DebuffBits + 7) / 8, RadialBits, (RadialBits + 7) / 8);
+	}));
+#endif
@@ -21,3 +21,27 @@ void UAuraAssetManager::StartInitialLoading()
 	//使用目标数据(TargetData)必须初始化全局数据
 	UAbilitySystemGlobals::Get().InitGlobalData();
 }
+
+/**
+ * @brief 以高优先级异步加载一组敌人类
+ *
+ * @param EnemyClassPaths 敌人类的软路径（重复/空路径会被忽略）
+ * @return 流式加载句柄；没有需要加载的路径时返回 nullptr
+ *
+ * 注意事项：
+ * - 已在内存中的类会立即完成，不会重复加载；
+ * - 调用方需持有句柄直到生成完成，否则资源可能被 GC 回收。
+ */
+TSharedPtr<FStreamableHandle> UAuraAssetManager::PreloadEnemyClasses(TArray<FSoftObjectPath> EnemyClassPaths)
+{
+	EnemyClassPaths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+	if (EnemyClassPaths.IsEmpty()) return nullptr;
+
+	return GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(EnemyClassPaths),
+		FStreamableDelegate(),
+		FStreamableManager::AsyncLoadHighPriority,
+		false,
+		false,
+		TEXT("AuraEnemyPreload"));
+}
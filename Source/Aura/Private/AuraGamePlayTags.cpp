@@ -72,6 +72,9 @@ void FAuraGamePlayTags::InitializeNativeGameplayTags()
 	/*
 	 * 输入操作标签
 	 */
+	GamePlayTags.InputTag = UGameplayTagsManager::Get().AddNativeGameplayTag(FName("InputTag"),
+	FString(TEXT("输入标签父级")));
+
 	GamePlayTags.InputTag_LMB = UGameplayTagsManager::Get().AddNativeGameplayTag(FName("InputTag.LMB"),
 	FString(TEXT("左键:鼠标输入左键标签")));
 	
@@ -165,6 +168,14 @@ void FAuraGamePlayTags::InitializeNativeGameplayTags()
 	GamePlayTags.DamageTypesToDebuffs.Add(GamePlayTags.Damage_Physical, GamePlayTags.Debuff_Physical);
 	GamePlayTags.DamageTypesToDebuffs.Add(GamePlayTags.Damage_Fire, GamePlayTags.Debuff_Burn);
 
+	/*
+	 * 伤害类型信息表（稠密索引，供伤害执行计算按下标遍历）
+	 */
+	GamePlayTags.DamageTypeInfos[EAuraDamageTypeIndex::Fire] = { GamePlayTags.Damage_Fire, GamePlayTags.Attributes_Resistance_Fire, GamePlayTags.Debuff_Burn };
+	GamePlayTags.DamageTypeInfos[EAuraDamageTypeIndex::Lightning] = { GamePlayTags.Damage_Lightning, GamePlayTags.Attributes_Resistance_Lightning, GamePlayTags.Debuff_Stun };
+	GamePlayTags.DamageTypeInfos[EAuraDamageTypeIndex::Arcane] = { GamePlayTags.Damage_Arcane, GamePlayTags.Attributes_Resistance_Arcane, GamePlayTags.Debuff_Arcane };
+	GamePlayTags.DamageTypeInfos[EAuraDamageTypeIndex::Physical] = { GamePlayTags.Damage_Physical, GamePlayTags.Attributes_Resistance_Physical, GamePlayTags.Debuff_Physical };
+
 
 	
 	GamePlayTags.Effects_HitReact= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Effects.HitReact"),
@@ -173,6 +184,9 @@ void FAuraGamePlayTags::InitializeNativeGameplayTags()
 	/*
 	 * 技能
 	 */
+	GamePlayTags.Abilities= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities"),
+	FString(TEXT("技能标签父级")));
+
 	GamePlayTags.Abilities_None= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities.None"),
 	FString(TEXT("没有技能 - 类似与标签中的空指针")));
 	
@@ -184,6 +198,8 @@ void FAuraGamePlayTags::InitializeNativeGameplayTags()
 	GamePlayTags.Abilities_HitReact= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities.HitReact"),
 	FString(TEXT("击中反应")));
 	
+	GamePlayTags.Abilities_Status= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities.Status"),
+	FString(TEXT("技能状态父级")));
 	GamePlayTags.Abilities_Status_Locked= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities.Status.Locked"),
 	FString(TEXT("技能状态：锁定")));
 	GamePlayTags.Abilities_Status_Eligible= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("Abilities.Status.Eligible"),
@@ -270,3 +286,16 @@ FString(TEXT("被动技能：法力摄取")));
 	GamePlayTags.GameplayCue_FireBlast= UGameplayTagsManager::Get().AddNativeGameplayTag(FName("GameplayCue.FireBlast"),
 	FString(TEXT("游戏提示：火焰爆发")));
 }
+
+int32 FAuraGamePlayTags::GetDamageTypeIndex(const FGameplayTag& DamageType) const
+{
+	// 伤害类型只有寥寥几种，线性比较比哈希查找更快
+	for (int32 Index = 0; Index < EAuraDamageTypeIndex::Num; ++Index)
+	{
+		if (DamageTypeInfos[Index].DamageType == DamageType)
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
@@ -24,6 +24,7 @@
 
 AAuraCharacter::AAuraCharacter()
 {
+	Team = EAuraTeam::Player;
 
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>("CameraBoom");
 	CameraBoom->SetupAttachment(RootComponent);
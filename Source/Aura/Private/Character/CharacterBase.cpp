@@ -9,6 +9,7 @@
 #include "Aura/Aura.h"
 #include "Components/CapsuleComponent.h"
 #include "Debuff/DebuffNiagaraComponent.h"
+#include "Game/AuraCombatantRegistry.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GAS/AuraAbilitySystemComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -249,6 +250,11 @@ void ACharacterBase::MulticastHandleDeath_Implementation (const FVector& DeathIm
 	
 	// 设置死亡状态标志。
 	bDead = true;
+	// 尸体不再参与范围/最近目标查询。
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		Registry->UnregisterCombatant(this);
+	}
 	
 	// 停用并隐藏燃烧和眩晕的粒子特效。
 	BurnDebuffComponent->Deactivate();
@@ -262,6 +268,51 @@ void ACharacterBase::MulticastHandleDeath_Implementation (const FVector& DeathIm
 	
 }
 
+/**
+ * @brief 撤销死亡表现，让角色恢复到刚生成时的状态（服务器与客户端都需调用）
+ *
+ * 详细流程：
+ * 1) 关闭网格体物理模拟，重新挂回胶囊体并还原相对变换（ACharacter 缓存的 BaseTranslationOffset/BaseRotationOffset）；
+ * 2) 碰撞设置从类默认对象读取，而不是写死，以保留蓝图中的配置；
+ * 3) 武器关闭物理并按默认插槽与相对变换重新挂到网格体上；
+ * 4) 还原被溶解材质替换的 0 号材质；
+ * 5) 清除死亡标志，重新注册到存活单位注册表。
+ *
+ * 注意事项：
+ * - 蓝图中的溶解时间轴如果仍在运行，只会作用于已被替换掉的动态材质，不影响还原结果。
+ */
+void ACharacterBase::ResetDeathState()
+{
+	const ACharacterBase* DefaultCharacter = GetClass()->GetDefaultObject<ACharacterBase>();
+
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+	GetMesh()->SetCollisionEnabled(DefaultCharacter->GetMesh()->GetCollisionEnabled());
+	GetMesh()->SetCollisionResponseToChannel(ECC_WorldStatic, DefaultCharacter->GetMesh()->GetCollisionResponseToChannel(ECC_WorldStatic));
+	GetCapsuleComponent()->SetCollisionEnabled(DefaultCharacter->GetCapsuleComponent()->GetCollisionEnabled());
+
+	Weapon->SetSimulatePhysics(false);
+	Weapon->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Weapon->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform, DefaultCharacter->Weapon->GetAttachSocketName());
+	Weapon->SetRelativeTransform(DefaultCharacter->Weapon->GetRelativeTransform());
+
+	if (DefaultMeshMaterial)
+	{
+		GetMesh()->SetMaterial(0, DefaultMeshMaterial);
+	}
+	if (DefaultWeaponMaterial)
+	{
+		Weapon->SetMaterial(0, DefaultWeaponMaterial);
+	}
+
+	bDead = false;
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		Registry->RegisterCombatant(this);
+	}
+}
+
 TArray<FTaggedMontage> ACharacterBase::GetAttackMontages_Implementation()
 {
 	return AttackMontages;
@@ -317,8 +368,23 @@ void ACharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 void ACharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	DefaultMeshMaterial = GetMesh()->GetMaterial(0);
+	DefaultWeaponMaterial = Weapon->GetMaterial(0);
 	
-	
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		Registry->RegisterCombatant(this);
+	}
+}
+
+void ACharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		Registry->UnregisterCombatant(this);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
 void ACharacterBase::InitAbilityActorInfo()
@@ -11,9 +11,12 @@
 #include "Aura/Public/AuraGamePlayTags.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BrainComponent.h"
+#include "Game/AuraEnemyPool.h"
 #include "GAS/AuraAbilitySystemComponent.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 #include "GAS/AuraAttributeSet.h"
+#include "Net/UnrealNetwork.h"
 #include "UI/Widget/AuraUserWidget.h"
 
 void AEnemyCharacter::PossessedBy(AController* NewController)
@@ -46,6 +49,7 @@ void AEnemyCharacter::PossessedBy(AController* NewController)
 
 AEnemyCharacter::AEnemyCharacter()
 {
+	Team = EAuraTeam::Enemy;
 	//设置网格体碰撞对可视性阻挡
 	GetMesh()->SetCollisionResponseToChannel(ECC_Visibility,ECR_Block);
 	//初始化AbilitySystemComponent组件
@@ -232,5 +236,122 @@ void AEnemyCharacter::StunTagChanged(const FGameplayTag CallbackTag, int32 NewCo
 	}
 }
 
+void AEnemyCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AEnemyCharacter, bPoolActive);
+}
+
+void AEnemyCharacter::LifeSpanExpired()
+{
+	if (bPooled && HasAuthority())
+	{
+		if (UAuraEnemyPool* Pool = UAuraEnemyPool::Get(this))
+		{
+			Pool->ReleaseEnemy(this);
+			return;
+		}
+	}
+	Super::LifeSpanExpired();
+}
+
+/**
+ * @brief 从回收池重新上场（服务器）
+ *
+ * @param SpawnTransform    生成变换
+ * @param InLevel           新的等级
+ * @param InCharacterClass  新的职业
+ *
+ * 详细流程：
+ * 1) 在生成点附近寻找不重叠的位置并传送过去（与 AdjustIfPossibleButAlwaysSpawn 的行为一致）；
+ * 2) 写入等级/职业，撤销死亡表现并取消隐藏；
+ * 3) 重新应用默认属性（生命值回满）并授予该职业的初始技能；
+ * 4) 由保留下来的 AI 控制器重新 Possess，PossessedBy 中会重新初始化黑板并运行行为树。
+ *
+ * 注意事项：
+ * - 属性变化委托、受击/眩晕标签事件在首次 BeginPlay 时已绑定，这里不能再次调用 InitAbilityActorInfo，否则会重复绑定。
+ */
+void AEnemyCharacter::ActivateFromPool(const FTransform& SpawnTransform, int32 InLevel, ECharacterClass InCharacterClass)
+{
+	FVector SpawnLocation = SpawnTransform.GetLocation();
+	FRotator SpawnRotation = SpawnTransform.Rotator();
+	GetWorld()->FindTeleportSpot(this, SpawnLocation, SpawnRotation);
+	SetActorLocationAndRotation(SpawnLocation, SpawnRotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	SetLevel(InLevel);
+	SetCharacterClass(InCharacterClass);
+
+	bPoolActive = true;
+	ResetDeathState();
+	SetPoolHidden(false);
+	bHitReacting = false;
+	GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed;
 
+	InitializeDefaultAttributes();
+	UAuraAbilitySystemLibrary::GiveStartupAbilities(this, AbilitySystemComponent, CharacterClass);
+
+	if (EnemyAIController)
+	{
+		EnemyAIController->Possess(this);
+		EnemyAIController->GetBlackboardComponent()->SetValueAsBool(FName("Dead"), false);
+	}
+	else
+	{
+		SpawnDefaultController();
+	}
+	ForceNetUpdate();
+}
 
+/**
+ * @brief 停用并放入回收池（服务器）
+ *
+ * 详细流程：
+ * 1) 停止行为树并让 AI 控制器 UnPossess，控制器本身保留，下次重新上场时复用；
+ * 2) 取消并移除全部技能、移除全部激活中的效果（减益标签随之移除）；
+ * 3) 清理战斗目标、仆从计数，隐藏并关闭碰撞与物理模拟。
+ */
+void AEnemyCharacter::DeactivateForPool()
+{
+	if (EnemyAIController)
+	{
+		if (UBrainComponent* BrainComponent = EnemyAIController->GetBrainComponent())
+		{
+			BrainComponent->StopLogic(TEXT("Pooled"));
+		}
+		EnemyAIController->UnPossess();
+	}
+
+	AbilitySystemComponent->CancelAllAbilities();
+	AbilitySystemComponent->ClearAllAbilities();
+	AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+
+	CombatTarget = nullptr;
+	MinionCount = 0;
+
+	bPoolActive = false;
+	SetPoolHidden(true);
+	ForceNetUpdate();
+}
+
+void AEnemyCharacter::SetPoolHidden(bool bPoolHidden)
+{
+	SetActorHiddenInGame(bPoolHidden);
+	SetActorEnableCollision(!bPoolHidden);
+	if (bPoolHidden)
+	{
+		// 隐藏期间不再模拟尸体与掉落的武器
+		GetMesh()->SetSimulatePhysics(false);
+		Weapon->SetSimulatePhysics(false);
+		GetCharacterMovement()->StopMovementImmediately();
+	}
+}
+
+void AEnemyCharacter::OnRep_PoolActive()
+{
+	if (bPoolActive)
+	{
+		ResetDeathState();
+	}
+	SetPoolHidden(!bPoolActive);
+}
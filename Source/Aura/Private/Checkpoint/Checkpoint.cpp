@@ -6,6 +6,7 @@
 
 #include "Components/SphereComponent.h"
 #include "Game/AuraGameModeBase.h"
+#include "Game/AuraSaveableActorRegistry.h"
 #include "Interation/PlayerInterface.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -34,6 +35,22 @@ ACheckpoint::ACheckpoint(const FObjectInitializer& ObjectInitializer)
 }
 
 
+/**
+ * @brief 设置是否已到达
+ *
+ * @param bInReached 新的到达状态
+ *
+ * 注意事项：
+ * - bReached 是 SaveGame 属性，增量存档只重新序列化标脏的 Actor，因此所有写入（含蓝图）都必须经过这里；
+ * - 值未变化时不标脏。
+ */
+void ACheckpoint::SetReached(bool bInReached)
+{
+	if (bReached == bInReached) return;
+	bReached = bInReached;
+	MarkSaveDirty();
+}
+
 /**
  * @brief (SaveInterface 接口实现) 在游戏状态被加载时调用，用于恢复检查点的视觉状态。
  *
@@ -166,7 +183,7 @@ void ACheckpoint::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AAct
 	if (OtherActor->Implements<UPlayerInterface>())
 	{
 		// 步骤 2/4: 更新自身状态并触发世界保存
-		bReached = true; // 标记此检查点已被触及。
+		SetReached(true); // 标记此检查点已被触及（同时通知存档系统下次保存时重新序列化本 Actor）。
 		if (AAuraGameModeBase* AuraGameMode = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(this)))
 		{
 
@@ -211,6 +228,24 @@ void ACheckpoint::BeginPlay()
 	
 }
 
+void ACheckpoint::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	if (UAuraSaveableActorRegistry* Registry = UAuraSaveableActorRegistry::Get(this))
+	{
+		Registry->RegisterSaveableActor(this);
+	}
+}
+
+void ACheckpoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraSaveableActorRegistry* Registry = UAuraSaveableActorRegistry::Get(this))
+	{
+		Registry->UnregisterSaveableActor(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 
 /**
  * @brief 处理检查点被激活时的发光视觉效果。
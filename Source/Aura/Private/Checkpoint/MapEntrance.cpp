@@ -54,7 +54,7 @@ void AMapEntrance::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AAc
 	if (OtherActor->Implements<UPlayerInterface>())
 	{
 		// 步骤 1/4: 标记为已触及（虽然在此类中可能作用不大，但继承自父类）
-		bReached = true;
+		SetReached(true);
 		// 步骤 2/4: 保存当前世界的状态。
 		if (AAuraGameModeBase* AuraGameMode = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(this)))
 		{
@@ -3,6 +3,7 @@
 
 #include "GAS/Ability/AuraBeamSpell.h"
 
+#include "Game/AuraCombatantRegistry.h"
 #include "GameFramework/Character.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
@@ -157,29 +158,23 @@ void UAuraBeamSpell::StoreAdditionalTargets(TArray<AActor*>& OutAdditionalTarget
 	ActorsToIgnore.Add(GetAvatarActorFromActorInfo());                    // 忽略施法者自身
 	ActorsToIgnore.Add(MouseHitActor);                                    // 忽略第一击中的对象
 
-	// 步骤 2：在命中点附近收集“活体单位”候选（已过滤忽略对象）
-	TArray<AActor*> OverlappingActors;
-	UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(
-		GetAvatarActorFromActorInfo(),                                     // World/上下文（或作为查询者）
-		OverlappingActors,                                                 // 输出：候选列表
-		ActorsToIgnore,                                                    // 输入：忽略对象
-		850.f,                                                             // 半径
-		MouseHitActor->GetActorLocation()                                  // 圆心：命中对象的位置
-	);
-
-	// 步骤 3：计算“需要的附加目标数” = min(能力等级-1, 系统上限)
-	int32 NumAdditionTargets = FMath::Min(GetAbilityLevel() - 1, MaxNumShockTargets);
-	// int32 NumAdditionTargets = 5;                                       // 旧的固定写法（注释保留用于对照）
-
-	// 步骤 4：从候选里挑出“距离命中点最近”的 N 个单位
-	UAuraAbilitySystemLibrary::GetClosestTargets(
-		NumAdditionTargets,                                                // 需要的目标数
-		OverlappingActors,                                                 // 候选池
-		OutAdditionalTargets,                                              // 输出：最终附加目标
-		MouseHitActor->GetActorLocation()                                  // 参考原点：命中点
-	);
-
-	// 步骤 5：为每个附加目标绑定“死亡回调”，用于链路断开/清理
+	// 步骤 2：计算“需要的附加目标数” = min(能力等级-1, 系统上限)
+	const int32 NumAdditionTargets = FMath::Max(FMath::Min(GetAbilityLevel() - 1, MaxNumShockTargets), 0);
+
+	// 步骤 3：在命中点 850 范围内直接取“距离最近”的 N 个活体单位
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(GetAvatarActorFromActorInfo()))
+	{
+		Registry->GetClosestCombatants(MouseHitActor->GetActorLocation(), NumAdditionTargets, 850.f, OutAdditionalTargets, ActorsToIgnore);
+	}
+	else
+	{
+		// 回退：物理 Overlap 收集候选，再挑最近的 N 个
+		TArray<AActor*> OverlappingActors;
+		UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(GetAvatarActorFromActorInfo(), OverlappingActors, ActorsToIgnore, 850.f, MouseHitActor->GetActorLocation());
+		UAuraAbilitySystemLibrary::GetClosestTargets(NumAdditionTargets, OverlappingActors, OutAdditionalTargets, MouseHitActor->GetActorLocation());
+	}
+
+	// 步骤 4：为每个附加目标绑定“死亡回调”，用于链路断开/清理
 	for (AActor* Target : OutAdditionalTargets)
 	{
 		// ⚠ 这里对 MouseHitActor 做了 Cast，而不是对 Target；通常应对 “Target” 进行绑定（见“建议 1”）
@@ -5,6 +5,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/AuraAbilitySystemLibrary.h"
 
 /**
  * @brief 对目标Actor施加伤害效果（通用伤害应用）
@@ -49,6 +50,42 @@ void UAuraDamageGameplayAbility::CauseDamage(AActor* TargetActor)
     // 建议：可加日志Debug TargetASC为空时的情况，方便排查
 }
 
+/**
+ * @brief 对一组目标施加本技能的伤害（AoE/链式技能的批量入口）
+ *
+ * @param TargetActors        受击目标列表（无 ASC 的 Actor 会被跳过）
+ * @param InRadialDamageOrigin 范围伤害原点（仅当 bIsRadialDamage 为 true 时使用）
+ * @param bOverridePitch       是否覆盖逐目标击退/死亡冲击方向的 Pitch
+ * @param PitchOverride        覆盖用的 Pitch 角度（单位：度）
+ *
+ * 功能说明：
+ * - 由类默认值构造一份伤害参数，交给 UAuraAbilitySystemLibrary::ApplyDamageEffectBatch 一次性分发；
+ * - 击退/死亡冲击方向由批量接口按“原点 → 目标”逐目标计算，强度取本技能配置。
+ *
+ * 注意事项：
+ * - 仅在服务器生效（伤害 GE 需由 Authority 施加）。
+ */
+void UAuraDamageGameplayAbility::CauseDamageToTargets(const TArray<AActor*>& TargetActors, FVector InRadialDamageOrigin, bool bOverridePitch, float PitchOverride)
+{
+    if (!HasAuthority(&CurrentActivationInfo) || TargetActors.Num() == 0) return;
+
+    // 来源侧参数只构造一次，方向由批量接口逐目标重算
+    UAuraAbilitySystemLibrary::ApplyDamageEffectToActors(MakeBatchDamageEffectParams(InRadialDamageOrigin, bOverridePitch, PitchOverride), TargetActors);
+}
+
+/**
+ * @brief 构造用于 ApplyDamageEffectBatch 的伤害参数
+ *
+ * @param InRadialDamageOrigin 范围伤害原点（仅当 bIsRadialDamage 为 true 时使用）
+ * @param bOverridePitch       是否覆盖逐目标方向的 Pitch（与单目标路径含义一致）
+ * @param PitchOverride        覆盖用的 Pitch 角度（单位：度）
+ * @return FDamageEffectParams 不含目标的参数集；方向由批量接口按 DeathImpulseMagnitude/KnockBackForceMagnitude 逐目标计算
+ */
+FDamageEffectParams UAuraDamageGameplayAbility::MakeBatchDamageEffectParams(FVector InRadialDamageOrigin, bool bOverridePitch, float PitchOverride) const
+{
+    return MakeDamageEffectParamsFromClassDefaults(nullptr, InRadialDamageOrigin, false, FVector::ZeroVector, false, FVector::ZeroVector, bOverridePitch, PitchOverride);
+}
+
 /**
  * @brief 由本 GA 的“类默认值”生产一次伤害用的参数集（FDamageEffectParams）
  *
@@ -101,6 +138,10 @@ FDamageEffectParams UAuraDamageGameplayAbility::MakeDamageEffectParamsFromClassD
     Params.DeathImpulseMagnitude = DeathImpulseMagnitude; // 死亡冲击强度
     Params.KnockBackForceMagnitude = KnockBackForceMagnitude; // 击退力度
     Params.KnockBackChance = KnockBackChance; // 击退几率
+    Params.bOverrideKnockbackDirection = bOverrideKnockbackDirection; // 记录方向覆写设置，批量路径逐目标计算时沿用
+    Params.bOverrideDeathImpulse = bOverrideDeathImpulse;
+    Params.bOverridePitch = bOverridePitch;
+    Params.PitchOverride = PitchOverride;
 
     // 若目标有效：用“Avatar→Target”的方向作为基础方向（除非后续覆写）
     if (IsValid(TargetActor))
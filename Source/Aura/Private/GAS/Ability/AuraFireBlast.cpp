@@ -4,6 +4,7 @@
 #include "GAS/Ability/AuraFireBlast.h"
 
 #include "Actor/AuraFireBall.h"
+#include "Game/AuraProjectilePool.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 
 FString UAuraFireBlast::GetDescription(int32 Level)
@@ -50,6 +51,20 @@ FString UAuraFireBlast::GetNextLevelDescription(int32 Level)
 }
 
 
+/**
+ * @brief 技能被授予时（服务器）预热火球对象池，一次施放需要 NumFireBalls 个
+ */
+void UAuraFireBlast::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	if (ActorInfo == nullptr || !ActorInfo->IsNetAuthority()) return;
+	if (UAuraProjectilePool* ProjectilePool = UAuraProjectilePool::Get(ActorInfo->AvatarActor.Get()))
+	{
+		ProjectilePool->PrewarmProjectiles(FireBallClass, NumFireBalls);
+	}
+}
+
 /**
  * @brief 以角色为圆心，等角度环形生成若干 FireBall 投射物（延迟生成，先配置再完成生成）
  *
@@ -85,6 +100,10 @@ TArray<AAuraFireBall*> UAuraFireBlast::SpawnFireBalls()
 	// 计算等角度旋转：围绕 Up 轴把 360° 平均分成 NumFireBalls 份               
 	TArray<FRotator> Rotators = UAuraAbilitySystemLibrary::EvenlySpacedRotators(ForWard, FVector::UpVector, 360.f, NumFireBalls);
 
+	UAuraProjectilePool* ProjectilePool = UAuraProjectilePool::Get(GetAvatarActorFromActorInfo());
+	if (ProjectilePool == nullptr) return FireBalls;
+	FireBalls.Reserve(Rotators.Num());
+
 	// 遍历每个旋转，逐个延迟生成 FireBall                                      
 	for (const FRotator& Rotator : Rotators)
 	{
@@ -93,15 +112,15 @@ TArray<AAuraFireBall*> UAuraFireBlast::SpawnFireBalls()
 		SpawnTransform.SetLocation(Location);
 		SpawnTransform.SetRotation(Rotator.Quaternion());
 
-		// 延迟生成投射物：可在 FinishSpawning 前设置默认属性                   
-		AAuraFireBall* FireBall = GetWorld()->SpawnActorDeferred<AAuraFireBall>
+		// 从对象池取出 FireBall（无空闲实例时延迟生成）：可在激活前设置默认属性
+		AAuraFireBall* FireBall = ProjectilePool->SpawnProjectileDeferred<AAuraFireBall>
 		(
 			FireBallClass,                                    // 要生成的类（应确保在外部已设置为有效 Blueprint/C++ 类）
 			SpawnTransform,                                   // 初始变换
 			GetOwningActorFromActorInfo(),                   // Owner：通常为拥有该 GA 的 Actor
-			CurrentActorInfo->PlayerController->GetPawn(),   // Instigator：用于伤害归属/仇恨（此处取玩家 Pawn）
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn  // 碰撞策略：总是生成
+			CurrentActorInfo->PlayerController->GetPawn()    // Instigator：用于伤害归属/仇恨（此处取玩家 Pawn）
 		);
+		if (FireBall == nullptr) continue;
 
 		// 注入该 FireBall 的伤害参数（从 GA 默认配置构造的 Params）              
 		FireBall->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
@@ -109,13 +128,14 @@ TArray<AAuraFireBall*> UAuraFireBlast::SpawnFireBalls()
 		// 设置“归返对象”（若 FireBall 需要回到施法者或跟随其位置）                
 		FireBall->ReturnToActor = GetAvatarActorFromActorInfo();
 
+		// 爆炸伤害由 BP_FireBall 逐目标调用 ApplyDamageEffect；同一帧、同一来源参数的调用共用一份伤害原型
 		FireBall->ExplosionDamageParams = MakeDamageEffectParamsFromClassDefaults();
 		FireBall->SetOwner(GetAvatarActorFromActorInfo());
 		// 收集到结果数组（此时对象已 spawn 但尚未 FinishSpawning）               
 		FireBalls.Add(FireBall);
 
 		// 完成生成（触发构造后逻辑/注册组件/BeginPlay 等）                       
-		FireBall->FinishSpawning(SpawnTransform);
+		ProjectilePool->FinishSpawningProjectile(FireBall, SpawnTransform);
 	}
 
 	// 返回本次生成的全部 FireBall                                          
@@ -6,7 +6,8 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AuraGamePlayTags.h"
 #include "Actor/AuraProjectile.h"
-#include "GameFramework/ProjectileMovementComponent.h"
+#include "Game/AuraProjectilePool.h"
+#include "Actor/AuraProjectileMovementComponent.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
@@ -109,22 +110,21 @@ FString UAuraFireBolt::GetNextLevelDescription(int32 Level)
 
 /**
  * @brief 在服务器上生成一批可跟踪（Homing）的火焰投射物，朝给定目标位置扇形发射
- * @param ProjectileTargetLocation 目标世界坐标（用于计算初始朝向/无锁定目标时的临时跟踪点）
+ * @param ProjectileTargetLocation 目标世界坐标（用于计算初始朝向/无锁定目标时的跟踪坐标）
  * @param SocketTag                发射用 Socket 的 GameplayTag（从角色或武器上取 Socket 位置）
  * @param bOverridePitch           是否覆盖俯仰角 Pitch（用于抬高/压低初始弹道）
  * @param PitchOverride            覆盖时使用的 Pitch 角（度）
- * @param HomingTarget             可选：锁定的跟踪目标 Actor（若为空则使用一个临时 SceneComponent 作为跟踪点）
+ * @param HomingTarget             可选：锁定的跟踪目标 Actor（若为空则直接跟踪 ProjectileTargetLocation）
  * @details
  *  - 【作用】按“扇形均匀分布”的多方向，延迟生成（Deferred Spawn）一组弹体；为每个弹体配置伤害参数与跟踪目标。
- *  - 【背景】Deferred Spawn 允许在 FinishSpawning 前设置构造参数；Homing 通过 ProjectileMovement 的 HomingTargetComponent 指向一个组件。
+ *  - 【背景】Deferred Spawn 允许在 FinishSpawning 前设置构造参数；Homing 通过 ProjectileMovement 的 HomingTargetComponent 指向一个组件，或由 UAuraProjectileMovementComponent 直接跟踪坐标。
  *  - 【流程】
  *    1) 仅在服务器生成（HasAuthority）；取 Combat Socket 世界位置；
  *    2) 算出从 Socket 指向目标的旋转，必要时覆盖 Pitch；得到 Forward 向量；
  *    3) 取“有效发射数量”（本地 NumProjectiles 与 Ability 等级取最小值），并根据扇形角生成等间距旋转；
- *    4) 循环：Deferred Spawn 投射物 → 写入伤害参数 → 设置 Homing 目标（锁定 Actor 或临时组件）→ 随机加速度 → 完成生成。
+ *    4) 循环：Deferred Spawn 投射物 → 写入伤害参数 → 设置 Homing 目标（锁定 Actor 或目标坐标）→ 随机加速度 → 完成生成。
  *  - 【注意】
  *    - 需确保服务器-客户端一致性：只在服务器 Spawn，复制由投射物自身的 Replication 设置完成。
- *    - 若使用临时 SceneComponent 作为 Homing 目标，必须有合适的 Outer/注册（见下方“优化建议”）。
  */
 void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, const FGameplayTag& SocketTag,bool bOverridePitch, float PitchOverride, AActor* HomingTarget)
 {
@@ -155,6 +155,9 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 	// 根据扇形角度与数量，生成等间隔的旋转序列（围绕世界 Up 轴展开）
 	TArray<FRotator> Rotations = UAuraAbilitySystemLibrary::EvenlySpacedRotators(Forward, FVector::UpVector, ProjectileSpread, EffectiveNumProjectiles); // 扇形旋转集
 
+	UAuraProjectilePool* ProjectilePool = UAuraProjectilePool::Get(GetAvatarActorFromActorInfo());
+	if (ProjectilePool == nullptr) return;
+
 	// 遍历每个方向，逐个生成投射物
 	for (const FRotator Rot : Rotations)
 	{
@@ -163,27 +166,25 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		SpawnTransform.SetLocation(SocketLocation); // 设置位置
 		SpawnTransform.SetRotation(Rot.Quaternion()); // 设置旋转
 
-		// 延迟生成投射物（使用 SpawnActorDeferred 允许在生成之前进行额外设置）
-		AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+		// 从对象池取出投射物（无空闲实例时延迟生成），在激活之前进行额外设置
+		AAuraProjectile* Projectile = ProjectilePool->SpawnProjectileDeferred(
 			ProjectileClass,                                  // 投射物的类
 			SpawnTransform,                                  // 生成时的位置和旋转
 			GetOwningActorFromActorInfo(),                  // 投射物的拥有者
-			Cast<APawn>(GetOwningActorFromActorInfo()),     // 投射物的“实例化者”（通常是 Pawn，表示角色）
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn // 碰撞处理方法（始终生成）
+			Cast<APawn>(GetOwningActorFromActorInfo())      // 投射物的“实例化者”（通常是 Pawn，表示角色）
 		);
+		if (Projectile == nullptr) continue;
 		//设置投射物默认伤害效果参数
 		Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults(); // 赋默认伤害参数（GE/等级/SetByCaller等）
 		
-		// 配置 Homing 目标：优先使用传入的锁定 Actor；否则创建临时跟踪点
+		// 配置 Homing 目标：优先使用传入的锁定 Actor；否则跟踪目标坐标
 		if (HomingTarget && HomingTarget->Implements<UCombatInterface>())
 		{
 			Projectile->ProjectileMovement->HomingTargetComponent = HomingTarget->GetRootComponent(); // 以目标根组件为 Homing 目标
 		}
 		else
 		{
-			Projectile->HomingTargetSceneComponent = NewObject<USceneComponent>(USceneComponent::StaticClass()); // 创建临时目标组件（见优化建议）
-			Projectile->HomingTargetSceneComponent->SetWorldLocation (ProjectileTargetLocation); // 放在指定世界坐标
-			Projectile->ProjectileMovement->HomingTargetComponent = Projectile->HomingTargetSceneComponent; // 使用该组件作为 Homing 目标
+			Projectile->ProjectileMovement->SetHomingTargetLocation(ProjectileTargetLocation); // 直接跟踪世界坐标（不创建临时组件）
 		}
 
 		// 设置 Homing 加速度范围（给每发弹体一定随机性）
@@ -192,8 +193,8 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		// 控制是否启用 Homing（由配置开关决定）
 		Projectile->ProjectileMovement->bIsHomingProjectile = bLaunchHomingProjectiles; // 启用/禁用跟踪
 		
-		// 完成投射物的生成，并应用最终的生成变换信息
-		Projectile->FinishSpawning(SpawnTransform); // 结束延迟生成（Spawn 完毕，进入世界）
+		// 完成投射物的生成（或重新激活），并应用最终的生成变换信息
+		ProjectilePool->FinishSpawningProjectile(Projectile, SpawnTransform);
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "AbilitySystemComponent.h"
 #include "AuraGamePlayTags.h"
 #include "Actor/AuraProjectile.h"
+#include "Game/AuraProjectilePool.h"
 #include "Interation/CombatInterface.h"
 
 
@@ -20,6 +21,20 @@ void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Hand
 
 }
 
+/**
+ * @brief 技能被授予时（服务器）预热投射物对象池，避免第一次施放时集中生成
+ */
+void UAuraProjectileSpell::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	if (ActorInfo == nullptr || !ActorInfo->IsNetAuthority()) return;
+	if (UAuraProjectilePool* ProjectilePool = UAuraProjectilePool::Get(ActorInfo->AvatarActor.Get()))
+	{
+		ProjectilePool->PrewarmProjectiles(ProjectileClass, NumProjectiles);
+	}
+}
+
 void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocation,const FGameplayTag& SocketTag, bool bOverridePitch, float PitchOverride)
 {
 
@@ -46,20 +61,22 @@ void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocati
 		SpawnTransform.SetLocation(SocketLocation);
 		SpawnTransform.SetRotation(Rotation.Quaternion());
 
-		// 延迟生成投射物（使用 SpawnActorDeferred 允许在生成之前进行额外设置）
-		AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+		// 从对象池取出投射物（无空闲实例时延迟生成），在激活之前进行额外设置
+		UAuraProjectilePool* ProjectilePool = UAuraProjectilePool::Get(GetAvatarActorFromActorInfo());
+		if (ProjectilePool == nullptr) return;
+		AAuraProjectile* Projectile = ProjectilePool->SpawnProjectileDeferred(
 			ProjectileClass,                                  // 投射物的类
 			SpawnTransform,                                  // 生成时的位置和旋转
 			GetOwningActorFromActorInfo(),                  // 投射物的拥有者
-			Cast<APawn>(GetOwningActorFromActorInfo()),     // 投射物的“实例化者”（通常是 Pawn，表示角色）
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn // 碰撞处理方法（始终生成）
+			Cast<APawn>(GetOwningActorFromActorInfo())      // 投射物的“实例化者”（通常是 Pawn，表示角色）
 		);
+		if (Projectile == nullptr) return;
 
 		//设置投射物默认伤害效果参数
 		Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
 		
-		// 完成投射物的生成，并应用最终的生成变换信息
-		Projectile->FinishSpawning(SpawnTransform);
+		// 完成投射物的生成（或重新激活），并应用最终的生成变换信息
+		ProjectilePool->FinishSpawningProjectile(Projectile, SpawnTransform);
 	
 		
 	
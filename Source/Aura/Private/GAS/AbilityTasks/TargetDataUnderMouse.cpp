@@ -4,6 +4,7 @@
 #include "GAS/AbilityTasks/TargetDataUnderMouse.h"
 #include "AbilitySystemComponent.h"
 #include "Aura/Aura.h"
+#include "Player/AuraPlayerController.h"
 
 
 UTargetDataUnderMouse* UTargetDataUnderMouse::CreateTargetDataUnderMouse(UGameplayAbility* OwningAbility)
@@ -55,8 +56,15 @@ void UTargetDataUnderMouse::SendMouseCursorData()
 	// 获取当前能力的玩家控制器（PlayerController）
 	APlayerController * PlayerController = Ability->GetCurrentActorInfo()->PlayerController.Get();
 	FHitResult CursorHit;
-	// 获取鼠标光标下的碰撞检测信息
-	PlayerController->GetHitResultUnderCursor(ECC_Target,false,CursorHit);
+	// 获取鼠标光标下的碰撞检测信息：瞄准固定使用 ECC_Target，结果缓存在该通道下，光标与视角未变化时直接复用
+	if (AAuraPlayerController* AuraPlayerController = Cast<AAuraPlayerController>(PlayerController))
+	{
+		AuraPlayerController->GetHitResultUnderCursorCached(ECC_Target, CursorHit, true);
+	}
+	else
+	{
+		PlayerController->GetHitResultUnderCursor(ECC_Target,false,CursorHit);
+	}
 	// 定义目标数据句柄
 	FGameplayAbilityTargetDataHandle DataHandle;
 	// 创建单目标命中数据对象
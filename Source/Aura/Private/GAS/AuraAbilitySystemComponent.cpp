@@ -167,8 +167,8 @@ void UAuraAbilitySystemComponent::AddCharacterPassiveAbilities(const TArray<TSub
  * @brief 处理“输入标签按下”：匹配到的 GA 标记为按下；未激活则尝试激活，已激活则广播 InputPressed（带正确 PredictionKey）
  * @param InputTag 按下的输入标签（如 InputTag.LMB / InputTag.Skill.Q 等）
  * @details
- *  - 使用新 API：AbilitySpec.GetDynamicSpecSourceTags() 进行标签匹配（代替已弃用 DynamicAbilityTags）
- *  - 遍历时使用 FScopedAbilityListLock，保证列表在迭代中的稳定性
+ *  - 通过“输入标签 → 规格”分发表直接取得绑定该输入的 GA（槽位变化时才重建），不再遍历全部规格
+ *  - 分发期间使用 FScopedAbilityListLock，保证列表在迭代中的稳定性
  *  - 通过 UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe 拿到实例上的 PredictionKey
  */
 void UAuraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& InputTag)
@@ -177,28 +177,25 @@ void UAuraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Inp
 	if(!InputTag.IsValid())return;
 	// 2) 遍历期间加锁，防止列表在激活/授予时被修改
 	FScopedAbilityListLock ActiveScopeLoc(*this);// 作用域锁
-	// 3) 遍历当前所有可激活的 GA（AbilitySpec）
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())// 遍历所有可激活能力
+	// 3) 从分发表取出绑定该输入标签的 GA
+	FInputTagSpecs InputSpecs;
+	GatherSpecsForInputTag(InputTag, InputSpecs);
+	for (FGameplayAbilitySpec* AbilitySpec : InputSpecs)
 	{
-		// 4) 用“动态源标签”精确匹配输入标签（HasTagExact：要求完全一致）
-		if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))// 匹配到绑定该输入的 GA
-		{
-			// 5) 本地标记“输入按下”（影响 GA 内部的 InputPressed 状态/回调）
-			AbilitySpecInputPressed(AbilitySpec);
+		// 4) 本地标记“输入按下”（影响 GA 内部的 InputPressed 状态/回调）
+		AbilitySpecInputPressed(*AbilitySpec);
 
-			// 6) 若 GA 已激活 → 广播“输入按下”复制事件（供任务/服务器路由）
-			if (AbilitySpec.IsActive())
-			{
-				// 6.1 从“实例”的 CurrentActivationInfo 中拿 PredictionKey（内部已做安全回退）
-				const FPredictionKey OriginalPredictionKey = UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe(AbilitySpec);
-				// 6.2 广播 InputPressed（客户端→服务器/其他端），保证 AbilityTask_WaitInputPress 能收到
-				InvokeReplicatedEvent(
-					EAbilityGenericReplicatedEvent::InputPressed,  // 事件类型：按下
-					AbilitySpec.Handle,                            // 该 GA 的句柄
-					OriginalPredictionKey                          // 正确的预测键
-					);
-			
-			}
+		// 5) 若 GA 已激活 → 广播“输入按下”复制事件（供任务/服务器路由）
+		if (AbilitySpec->IsActive())
+		{
+			// 5.1 从“实例”的 CurrentActivationInfo 中拿 PredictionKey（内部已做安全回退）
+			const FPredictionKey OriginalPredictionKey = UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe(*AbilitySpec);
+			// 5.2 广播 InputPressed（客户端→服务器/其他端），保证 AbilityTask_WaitInputPress 能收到
+			InvokeReplicatedEvent(
+				EAbilityGenericReplicatedEvent::InputPressed,  // 事件类型：按下
+				AbilitySpec->Handle,                           // 该 GA 的句柄
+				OriginalPredictionKey                          // 正确的预测键
+				);
 		}
 	}
 }
@@ -207,9 +204,9 @@ void UAuraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Inp
  * @brief 处理“输入标签按住”（Held）：为匹配该输入的 GA 标记 InputPressed；未激活则尝试激活
  * @param InputTag 按住的输入标签
  * @details
- *  - 流程：校验标签 → 遍历可激活 GA → 若动态标签包含该 InputTag：调用 AbilitySpecInputPressed；
+ *  - 流程：校验标签 → 从分发表取出绑定该 InputTag 的 GA：调用 AbilitySpecInputPressed；
  *    若 GA 未激活则 TryActivateAbility。
- *  - 注意：此实现使用了已弃用字段 DynamicAbilityTags，应切换到 GetDynamicSpecSourceTags()。
+ *  - 按住期间每帧调用，分发表使其只需一次哈希查找，而非遍历全部规格并逐个搜索标签容器。
  */
 void UAuraAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InputTag)
 {
@@ -218,22 +215,19 @@ void UAuraAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InputT
 
 	// 遍历期间更安全
 	FScopedAbilityListLock AbilityScopeLock(*this);
-	// 遍历所有可激活的技能
-	// GetActivatableAbilities 获取当前组件中的所有可激活技能。
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	// 从分发表取出绑定该输入标签的技能
+	FInputTagSpecs InputSpecs;
+	GatherSpecsForInputTag(InputTag, InputSpecs);
+	for (FGameplayAbilitySpec* AbilitySpec : InputSpecs)
 	{
-		// 检查当前技能的动态标签中是否有精确匹配的输入标签
-		if (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag))
-		{
-			// 标记该技能的输入为已按下（保持“持续输入”）
-			AbilitySpecInputPressed(AbilitySpec);
+		// 标记该技能的输入为已按下（保持“持续输入”）
+		AbilitySpecInputPressed(*AbilitySpec);
 
-			// 如果技能当前未处于激活状态
-			if (!AbilitySpec.IsActive())
-			{
-				// 尝试激活该技能（支持按住触发/引导型 GA）
-				TryActivateAbility(AbilitySpec.Handle);
-			}
+		// 如果技能当前未处于激活状态
+		if (!AbilitySpec->IsActive())
+		{
+			// 尝试激活该技能（支持按住触发/引导型 GA）
+			TryActivateAbility(AbilitySpec->Handle);
 		}
 	}
 }
@@ -242,7 +236,7 @@ void UAuraAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InputT
  * @param InputTag 松开的输入标签
  * @details
  *  - 保证与 Pressed 对称：先本地标记 Released，再广播 InputReleased
- *  - 使用新 API：AbilitySpec.GetDynamicSpecSourceTags()；并通过安全函数获取 PredictionKey
+ *  - 通过“输入标签 → 规格”分发表取得绑定该输入的 GA；并通过安全函数获取 PredictionKey
  *  - WaitInputRelease 的 OnReleased 依赖正确的 PredictionKey 路由，否则不会触发
  */
 void UAuraAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& InputTag)
@@ -251,24 +245,24 @@ void UAuraAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& In
 	if(!InputTag.IsValid())return;                            // 1) 无效标签直接返回
 	// 2) 遍历期间加锁，防止容器被改动
 	FScopedAbilityListLock ActiveScopeLoc(*this); // 作用域锁
-	// 3) 遍历当前所有可激活的 GA
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities()) // 2) 遍历所有可激活能力
+	// 3) 从分发表取出绑定该输入标签的 GA
+	FInputTagSpecs InputSpecs;
+	GatherSpecsForInputTag(InputTag, InputSpecs);
+	for (FGameplayAbilitySpec* AbilitySpec : InputSpecs)
 	{
-		// 4) 匹配到该输入标签，且 GA 当前处于激活中（只对激活中的 GA 广播松开）
-		if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag) && AbilitySpec.IsActive())
-		{
-			// 5) 本地标记“输入已释放”（影响 GA 内部 InputReleased 状态/回调）
-			AbilitySpecInputReleased(AbilitySpec);// 标记松开
-			// 6) 从“实例”的 CurrentActivationInfo 获取预测键（若无实例则内部回退旧字段）
-			const  FPredictionKey OriginalPredictionKey = UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe(AbilitySpec);
-			// 7) 广播“输入释放”复制事件（ASC→GA→AbilityTask）；WaitInputRelease 的 OnReleased 才会触发
-			InvokeReplicatedEvent(
-				EAbilityGenericReplicatedEvent::InputReleased, // 事件类型：松开
-				AbilitySpec.Handle,                            // 该 GA 的句柄
-				OriginalPredictionKey                         // 正确的预测键
-				);
-		
-		}
+		// 4) 只对激活中的 GA 广播松开
+		if (!AbilitySpec->IsActive()) continue;
+
+		// 5) 本地标记“输入已释放”（影响 GA 内部 InputReleased 状态/回调）
+		AbilitySpecInputReleased(*AbilitySpec);// 标记松开
+		// 6) 从“实例”的 CurrentActivationInfo 获取预测键（若无实例则内部回退旧字段）
+		const  FPredictionKey OriginalPredictionKey = UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe(*AbilitySpec);
+		// 7) 广播“输入释放”复制事件（ASC→GA→AbilityTask）；WaitInputRelease 的 OnReleased 才会触发
+		InvokeReplicatedEvent(
+			EAbilityGenericReplicatedEvent::InputReleased, // 事件类型：松开
+			AbilitySpec->Handle,                           // 该 GA 的句柄
+			OriginalPredictionKey                          // 正确的预测键
+			);
 	}
 }
 
@@ -309,7 +303,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetAbilityTagFromSpec(const FGameplayA
 		for (FGameplayTag Tag : AbilitySpec.Ability.Get()->AbilityTags)
 		{
 			// 检查是否在 "Abilities" 分类下（允许层级匹配）
-			if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities"))))
+			if (Tag.MatchesTag(FAuraGamePlayTags::Get().Abilities))
 			{
 				return Tag; // 返回匹配到的能力标签
 			}
@@ -330,7 +324,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetInputTagFromSpec(const FGameplayAbi
 	for (FGameplayTag Tag : AbilitySpec.DynamicAbilityTags)
 	{
 		// 检查是否属于 "InputTag" 分类（父子层级匹配）
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("InputTag"))))
+		if (Tag.MatchesTag(FAuraGamePlayTags::Get().InputTag))
 		{
 			return Tag; // 返回匹配到的输入标签
 		}
@@ -360,7 +354,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbili
 	for (FGameplayTag StatusTag : AbilitySpec.DynamicAbilityTags)
 	{
 		// 检查标签是否属于"Abilities.Status"分类
-		if (StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities.Status"))))
+		if (StatusTag.MatchesTag(FAuraGamePlayTags::Get().Abilities_Status))
 		{
 			// 返回找到的状态标签
 			return StatusTag;
@@ -387,13 +381,12 @@ FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbili
  */
 FGameplayTag UAuraAbilitySystemComponent::GetStatusFromAbilityTag(const FGameplayTag& AbilityTag)
 {
-	// 步骤 1：尝试用 AbilityTag 找到对应的能力规格（Spec）
-	if (const FGameplayAbilitySpec* Spec = GetSpecFromAbilityTag(AbilityTag)) // 找到则进入
+	// 索引中已为每个规格缓存了状态标签，无需再遍历其动态标签
+	RebuildAbilitySpecIndexIfNeeded();
+	if (const int32* ItemIndex = AbilitySpecIndex.AbilityTagToItem.Find(AbilityTag))
 	{
-		// 步骤 2：从 Spec 中解析并返回“状态标签”
-		return GetStatusFromSpec(*Spec); // 例如返回 Abilities_Status_Equipped / Abilities_Status_Unlocked 等
+		return AbilitySpecIndex.ItemStatuses[*ItemIndex]; // 例如返回 Abilities_Status_Equipped / Abilities_Status_Unlocked 等
 	}
-	// 步骤 3：未找到对应 Spec，返回“空标签”
 	return FGameplayTag(); // 无效标签，调用端可用 IsValid() 判断
 }
 
@@ -478,31 +471,15 @@ void UAuraAbilitySystemComponent::ServerUpgradeAttribute(const FGameplayTag& Att
  * @return 找到的技能规格指针，未找到返回nullptr
  * 
  * 功能说明：
- * 1. 使用作用域锁确保遍历过程中技能列表不会被修改
- * 2. 遍历所有可激活技能
- * 3. 检查每个技能的标签是否匹配目标标签
+ * 1. 通过“技能标签 → 规格下标”的二级索引直接定位，O(1)
+ * 2. 索引在授予/移除技能、技能标签变化以及客户端 OnRep 时失效，下次查询时重建
+ *
+ * 注意事项：
+ * - 按技能自身 AbilityTags 精确匹配（调用方传入的都是具体技能标签，如 Abilities.Fire.FireBolt）
  */
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecFromAbilityTag(const FGameplayTag& AbilityTag)
 {
-	// 创建作用域锁：防止遍历过程中技能列表被修改
-	// 重要：确保线程安全和数据一致性
-	FScopedAbilityListLock ActiveScopeLock(*this);
-	// 遍历所有可激活技能
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
-	{
-		// 遍历当前技能的所有标签
-		for (FGameplayTag Tag : AbilitySpec.Ability.Get()->AbilityTags)
-		{
-			// 检查标签是否匹配（支持父子标签匹配）
-			if (Tag.MatchesTag(AbilityTag))
-			{
-				// 返回找到的技能规格
-				return &AbilitySpec;
-			}
-		}
-	}
-	// 未找到匹配技能
-	return nullptr;
+	return FindIndexedSpec(AbilitySpecIndex.AbilityTagToItem, AbilityTag);
 }
 
 
@@ -630,6 +607,7 @@ void UAuraAbilitySystemComponent::ServerSpendSpellPoint_Implementation(const FGa
 
         // 标记技能规格为已修改，触发网络同步
         MarkAbilitySpecDirty(*AbilitySpec);
+        MarkAbilitySpecIndexDirty();
     }
 }
 
@@ -707,6 +685,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(
 
                     // 步骤 7.4：清空旧能力的槽位标签（释放该 Slot）
                     ClearSlot(SpecWithSlot);
+                    MarkAbilitySpecIndexDirty();
                     // 注意：此处可视情况 MarkAbilitySpecDirty(*SpecWithSlot) 以立刻同步旧 Spec 的变更（见建议）
                 }
             }
@@ -729,6 +708,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(
             AssignSlotToAbility(*AbilitySpec, Slot);
             // 步骤 10：标记该 Spec“脏”，驱动 GAS 复制/同步
             MarkAbilitySpecDirty(*AbilitySpec);
+            MarkAbilitySpecIndexDirty();
         }
         
         // 步骤 11：向客户端发送“已装备”通知（用于 UI 刷新、快捷栏高亮等）
@@ -740,39 +720,15 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(
 /**
  * @brief 查询指定“槽位”是否为空（即：当前可激活能力列表中，没有任何 GA 标记了该槽位）
  *
- * @param Slot 槽位的 GameplayTag（例如 Abilities.Slot.Q / Abilities.Slot.LMB）
+ * @param Slot 槽位的 GameplayTag（例如 InputTag.1 / InputTag.LMB）
  * @return bool 为空则返回 true（可用于判定“能否装备到该槽位”）
  *
  * 功能说明：
- * - 遍历本 ASC 的“可激活能力列表”，一旦发现有能力的“动态标签”包含该槽位，即认为槽位被占用。
- * - 使用 FScopedAbilityListLock 保护遍历期的能力列表不被并发修改（GAS 内部约定）。
- *
- * 详细流程：
- * 1) 加锁能力列表；2) 遍历每个 FGameplayAbilitySpec；3) 调用 AbilityHasSlot 判断是否带有 Slot 标签；
- * 4) 若命中则立即返回 false；5) 全部未命中则返回 true。
- *
- * 注意事项：
- * - HasTag 为包含匹配，若希望“完全一致”，可改用 HasTagExact（见下方“建议与优化”）。
- * - 此处使用的是 Spec.DynamicAbilityTags（旧 API 会在新版产生警告），建议迁移到 GetDynamicSpecSourceTags。
- * - 遍历复杂度 O(N)，N 为可激活能力数量；一般足够快，如需高频查询可做缓存映射。
+ * - 通过“槽位 → 规格下标”索引直接判断，O(1)。
  */
 bool UAuraAbilitySystemComponent::SlotIsEmpty(const FGameplayTag& Slot)
 {
-	// 步骤 1：加锁能力列表，防止遍历过程中被修改（GAS 线程/复制安全约定）
-	FScopedAbilityListLock ActiveScopeLock(*this); // 进入作用域即加锁，函数结束自动解锁
-
-	// 步骤 2：遍历当前“可激活能力”集合
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities()) // 逐个检查能力规格（Spec）
-	{
-		// 步骤 3：判断该能力是否“拥有该槽位”
-		if (AbilityHasSlot(AbilitySpec, Slot))     // 命中即说明槽位已被占用
-		{
-			return false;                          // 立即返回“非空”
-		}
-	}
-
-	// 步骤 4：遍历完成仍未命中 → 槽位为空
-	return true;                                   // 空槽位
+	return GetSpecWithSlot(Slot) == nullptr;
 }
 
 /**
@@ -812,44 +768,20 @@ bool UAuraAbilitySystemComponent::AbilityHasSlot(const FGameplayAbilitySpec& Spe
 bool UAuraAbilitySystemComponent::AbilityHasAnySlot(const FGameplayAbilitySpec& Spec)
 {
 	// 用父标签“InputTag”作为槽位命名空间（约定所有具体槽位都在其之下）
-	return Spec.GetDynamicSpecSourceTags().HasTag(FGameplayTag::RequestGameplayTag(FName("InputTag"))); // 命中父标签即认为有槽位
+	return Spec.GetDynamicSpecSourceTags().HasTag(FAuraGamePlayTags::Get().InputTag); // 命中父标签即认为有槽位
 }
 /**
- * @brief 通过“槽位标签”在当前 ASC 的可激活能力中查找对应的 Spec 指针
+ * @brief 根据槽位标签获取占用该槽位的技能规格
  *
- * @param Slot 槽位标签（如 Abilities.Slot.LMB / Abilities.Slot.Q），要求精确匹配
- * @return FGameplayAbilitySpec* 找到则返回该 Spec 的指针；找不到返回 nullptr
- *
- * 功能说明：
- * - 对可激活能力列表做一次线性遍历，查找“动态源标签”中**精确包含** Slot 的能力。
- * - 使用 FScopedAbilityListLock 保护遍历期间的列表一致性（GAS 约定）。
- *
- * 详细流程：
- * 1) 加锁能力列表；2) 遍历每个 Spec；3) 用 GetDynamicSpecSourceTags().HasTagExact(Slot) 判断；
- * 4) 命中立即返回该 Spec；5) 遍历完未命中则返回 nullptr。
+ * @param Slot 槽位的 GameplayTag（精确匹配）
+ * @return FGameplayAbilitySpec* 命中返回规格指针；未绑定该槽位返回 nullptr
  *
  * 注意事项：
- * - 若项目中允许一个槽位绑定多个能力，需要约定“优先返回哪一个”；当前实现返回**第一个命中**的 Spec。
- * - 若高频调用，可考虑维护“Slot → SpecHandle”的缓存表以降到 O(1) 查询（见文末建议）。
+ * - 返回的指针指向 ActivatableAbilities.Items 内部元素，授予/移除技能后会失效，不要长期持有。
  */
-//（命名建议：GetSpecWithSlot；当前函数名 GetSpecWithSlot 拼写可能有误）
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecWithSlot(const FGameplayTag& Slot)
 {
-	// 步骤 1：加锁能力列表，防止遍历过程中被修改（复制/添加/移除）
-	FScopedAbilityListLock ActiveScopeLock(*this); // 作用域结束自动解锁
-
-	// 步骤 2：遍历所有“可激活能力”规格
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities()) // 线性扫描 O(N)
-	{
-		// 步骤 3：判断该能力的“动态源标签”是否**精确**包含该槽位标签
-		if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(Slot))   // 精确匹配，避免父/子标签误判
-		{
-			return &AbilitySpec;                                        // 命中：返回指向该 Spec 的指针
-		}
-	}
-
-	// 步骤 4：未命中任何能力，返回空指针
-	return nullptr;                                                     // 未绑定该槽位
+	return FindIndexedSpec(AbilitySpecIndex.SlotToItem, Slot);
 }
 
 
@@ -1008,30 +940,20 @@ void UAuraAbilitySystemComponent::ClearSlot(FGameplayAbilitySpec* Spec)
 }
 
 /**
- * 清除指定槽位上的所有技能
+ * 清除指定槽位上的技能
  * 
  * @param Slot 需要清除的技能槽位标签
  * 
  * 功能说明：
- * 1. 锁定当前活动技能列表，确保线程安全。
- * 2. 遍历所有可激活的技能规格。
- * 3. 检查每个技能规格是否包含指定槽位标签。
- * 4. 如果包含，调用ClearSlot函数清除该技能的槽位标签。
+ * 1. 通过槽位索引找到占用该槽位的技能规格（槽位唯一，最多一个）。
+ * 2. 调用ClearSlot函数清除该技能的槽位标签，并使索引失效。
  */
 void UAuraAbilitySystemComponent::ClearAbilitiesOfSlot(const FGameplayTag& Slot)
 {
-	// 1. 锁定当前活动技能列表以避免线程冲突
-	FScopedAbilityListLock ActiveScopeLock(*this);
-    
-	// 2. 遍历所有可激活的技能规格
-	for (FGameplayAbilitySpec& Spec : GetActivatableAbilities())
+	if (FGameplayAbilitySpec* Spec = GetSpecWithSlot(Slot))
 	{
-		// 3. 检查技能规格是否有指定的槽位标签
-		if (AbilityHasSlot(&Spec, Slot))
-		{
-			// 4. 清除该技能的槽位标签
-			ClearSlot(&Spec);
-		}
+		ClearSlot(Spec);
+		MarkAbilitySpecIndexDirty();
 	}
 }
 
@@ -1071,6 +993,8 @@ bool UAuraAbilitySystemComponent::AbilityHasSlot(FGameplayAbilitySpec* Spec, con
 void UAuraAbilitySystemComponent::OnRep_ActivateAbilities()
 {
 	Super::OnRep_ActivateAbilities();
+	// 客户端：复制下来的规格列表或其动态标签可能已变化，索引失效
+	MarkAbilitySpecIndexDirty();
 	// 首次同步时触发委托
 	if (!bStartupAbilitiesGiven)
 	{
@@ -1104,4 +1028,124 @@ void UAuraAbilitySystemComponent::ClientEffectApplied_Implementation(UAbilitySys
 
 }
 
+/**
+ * [授予能力回调] 服务器 GiveAbility 与客户端复制新增规格时都会调用
+ */
+void UAuraAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+	MarkAbilitySpecIndexDirty();
+}
+
+/**
+ * [移除能力回调] 服务器 ClearAbility 与客户端复制移除规格时都会调用
+ */
+void UAuraAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+	MarkAbilitySpecIndexDirty();
+}
+
+/**
+ * @brief 使技能规格二级索引失效（下次查询时重建）
+ *
+ * 注意事项：
+ * - 任何修改规格“技能标签/槽位/状态”的代码（如 AssignSlotToAbility、ClearSlot、状态替换）都应随后调用本函数；
+ * - 授予/移除技能与客户端 OnRep 已自动处理。
+ */
+void UAuraAbilitySystemComponent::MarkAbilitySpecIndexDirty()
+{
+	bAbilitySpecIndexDirty = true;
+}
+
+/**
+ * @brief 若索引已失效（或规格数组长度与索引不一致），一次性遍历可激活能力列表重建索引
+ *
+ * 详细流程：
+ * 1) 清空三张表（保留容量，避免重复分配）；
+ * 2) 遍历 ActivatableAbilities.Items，记录：技能自身的 AbilityTags → 下标、动态标签中的 InputTag.* → 下标（及输入分发表）、状态标签；
+ * 3) 同名键保留首个（与旧的线性查找“命中即返回”的语义一致）。
+ */
+void UAuraAbilitySystemComponent::RebuildAbilitySpecIndexIfNeeded()
+{
+	const TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	if (!bAbilitySpecIndexDirty && AbilitySpecIndex.ItemHandles.Num() == Specs.Num()) return;
+
+	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	AbilitySpecIndex.AbilityTagToItem.Reset();
+	AbilitySpecIndex.SlotToItem.Reset();
+	AbilitySpecIndex.InputTagToItems.Reset();
+	AbilitySpecIndex.ItemHandles.Reset(Specs.Num());
+	AbilitySpecIndex.ItemStatuses.Reset(Specs.Num());
 
+	for (int32 ItemIndex = 0; ItemIndex < Specs.Num(); ++ItemIndex)
+	{
+		const FGameplayAbilitySpec& Spec = Specs[ItemIndex];
+		AbilitySpecIndex.ItemHandles.Add(Spec.Handle);
+		AbilitySpecIndex.ItemStatuses.Add(GetStatusFromSpec(Spec));
+
+		if (Spec.Ability)
+		{
+			for (const FGameplayTag& Tag : Spec.Ability->AbilityTags)
+			{
+				AbilitySpecIndex.AbilityTagToItem.FindOrAdd(Tag, ItemIndex);
+			}
+		}
+		for (const FGameplayTag& Tag : Spec.GetDynamicSpecSourceTags())
+		{
+			if (Tag.MatchesTag(GamePlayTags.InputTag))
+			{
+				AbilitySpecIndex.SlotToItem.FindOrAdd(Tag, ItemIndex);
+				AbilitySpecIndex.InputTagToItems.FindOrAdd(Tag).Add(ItemIndex);
+			}
+		}
+	}
+	bAbilitySpecIndexDirty = false;
+}
+
+/**
+ * @brief 在指定索引表中查找规格；并校验下标处的句柄，防止索引未及时失效时返回错误规格
+ */
+FGameplayAbilitySpec* UAuraAbilitySystemComponent::FindIndexedSpec(const TMap<FGameplayTag, int32>& IndexMap, const FGameplayTag& Key)
+{
+	RebuildAbilitySpecIndexIfNeeded();
+	const int32* ItemIndex = IndexMap.Find(Key);
+	if (ItemIndex == nullptr) return nullptr;
+
+	TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	if (Specs.IsValidIndex(*ItemIndex) && Specs[*ItemIndex].Handle == AbilitySpecIndex.ItemHandles[*ItemIndex])
+	{
+		return &Specs[*ItemIndex];
+	}
+
+	// 句柄不一致：说明规格数组在未通知的情况下发生了变化，强制重建后再查一次
+	MarkAbilitySpecIndexDirty();
+	RebuildAbilitySpecIndexIfNeeded();
+	ItemIndex = IndexMap.Find(Key);
+	return ItemIndex ? &Specs[*ItemIndex] : nullptr;
+}
+
+/**
+ * @brief 输入分发：取出绑定了指定输入标签的全部规格（按规格数组顺序）
+ *
+ * @param InputTag 输入标签（精确匹配）
+ * @param OutSpecs 输出：规格指针；调用方须持有 FScopedAbilityListLock，保证分发期间指针有效
+ *
+ * 注意事项：
+ * - 先拷贝出指针再分发，避免 GA 激活过程中触发索引重建导致遍历中的表被清空。
+ */
+void UAuraAbilitySystemComponent::GatherSpecsForInputTag(const FGameplayTag& InputTag, FInputTagSpecs& OutSpecs)
+{
+	RebuildAbilitySpecIndexIfNeeded();
+	const TArray<int32, TInlineAllocator<2>>* ItemIndices = AbilitySpecIndex.InputTagToItems.Find(InputTag);
+	if (ItemIndices == nullptr) return;
+
+	TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	for (const int32 ItemIndex : *ItemIndices)
+	{
+		if (Specs.IsValidIndex(ItemIndex) && Specs[ItemIndex].Handle == AbilitySpecIndex.ItemHandles[ItemIndex])
+		{
+			OutSpecs.Add(&Specs[ItemIndex]);
+		}
+	}
+}
@@ -4,8 +4,102 @@
 #include "GAS/AuraAbilitySystemGlobals.h"
 
 #include "AuraAbilityTypes.h"
+#include "AuraGamePlayTags.h"
+#include "GameplayEffect.h"
+#include "GAS/AuraAttributeSet.h"
+#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
 
 FGameplayEffectContext* UAuraAbilitySystemGlobals::AllocGameplayEffectContext() const
 {
 	return new FAuraGameplayEffectContext();
 }
+
+void UAuraAbilitySystemGlobals::InitGlobalData()
+{
+	Super::InitGlobalData();
+
+	// 预热 Context 内存池，使命中路径上的分配全部命中池
+	FAuraGameplayEffectContext::ReservePool(NumPreallocatedEffectContexts);
+}
+
+/**
+ * @brief 获取（或创建并缓存）动态 Debuff 的 GameplayEffect 定义
+ *
+ * @param DamageType      伤害类型（决定 Debuff 标签，如 火焰 → 燃烧）
+ * @param DebuffDuration  Debuff 持续时间（秒）
+ * @param DebuffFrequency Debuff 触发间隔（秒/次）
+ * @return UGameplayEffect* 可复用的 GE 定义；伤害类型没有对应 Debuff 时返回 nullptr
+ *
+ * 功能说明：
+ * - 以前每次 Debuff 触发都会 NewObject 一个临时 GE，大量燃烧/眩晕时产生海量瞬态 UObject，加重 GC 负担；
+ * - 现在按（伤害类型, 持续时间, 频率）缓存 GE，每跳伤害改为 SetByCaller（Debuff.Damage），因此无需按伤害值分桶。
+ *
+ * 注意事项：
+ * - 持续时间与频率按毫秒量化作为键，避免浮点误差导致缓存无限增长；
+ * - 同一 GE 定义共享后 AggregateBySource + StackLimitCount=1 的叠加规则真正生效：同一来源重复施加会刷新而非叠加。
+ */
+UGameplayEffect* UAuraAbilitySystemGlobals::FindOrCreateDebuffEffect(const FGameplayTag& DamageType, float DebuffDuration, float DebuffFrequency)
+{
+	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	const FGameplayTag* DebuffTagPtr = GamePlayTags.DamageTypesToDebuffs.Find(DamageType);
+	if (DebuffTagPtr == nullptr) return nullptr;
+	const FGameplayTag DebuffTag = *DebuffTagPtr;
+
+	// GE 名称即缓存键（伤害类型 + 毫秒量化的持续时间/频率）
+	const FName DebuffName(*FString::Printf(TEXT("DynamicDebuff_%s_%d_%d"),
+		*DamageType.ToString(),
+		FMath::RoundToInt(DebuffDuration * 1000.f),
+		FMath::RoundToInt(DebuffFrequency * 1000.f)));
+	if (const TObjectPtr<UGameplayEffect>* CachedEffect = DebuffEffectCache.Find(DebuffName))
+	{
+		return *CachedEffect;
+	}
+
+	// 在 Transient 包中创建 GE（由缓存持有引用，不会被 GC）
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), DebuffName);
+
+	// 设置为“有持续时间”的 GE
+	Effect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+
+	// 设置周期间隔（>0 才会周期触发）
+	Effect->Period = DebuffFrequency;
+
+	// 设置持续时间（可伸缩浮点包装）
+	Effect->DurationMagnitude = FScalableFloat(DebuffDuration);
+
+	// 关键：首跳不在应用瞬间执行
+	Effect->bExecutePeriodicEffectOnApplication = false;
+
+	// 构造目标标签容器（通过组件式 API 添加到目标）
+	FInheritedTagContainer TagContainer = FInheritedTagContainer();
+	UTargetTagsGameplayEffectComponent& Component = Effect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>();
+
+	// 将“伤害类型 → Debuff 标签”的映射结果加入容器
+	TagContainer.Added.AddTag(DebuffTag);
+	// 如果Debuff标签为 晕眩 时
+	if (DebuffTag.MatchesTagExact(GamePlayTags.Debuff_Stun))
+	{
+		//将“ 阻止光标追踪，移动，输入已按下，输入已松开等 Debuff 标签”的映射结果加入容器，阻止这些效果 
+		TagContainer.Added.AddTag(GamePlayTags.Player_Block_CursorTrace);
+		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputHeld);
+		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputPressed);
+		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputReleased);
+	}
+	Component.SetAndApplyTargetTagChanges(TagContainer);
+
+	// 叠加策略：同一来源聚合，最大叠加层数为 1
+	Effect->StackingType = EGameplayEffectStackingType::AggregateBySource;
+	Effect->StackLimitCount = 1;
+
+	// 每跳伤害：对 IncomingDamage 做加法，数值由 Spec 的 SetByCaller（Debuff.Damage）提供
+	FGameplayModifierInfo ModifierInfo;
+	FSetByCallerFloat SetByCallerDamage;
+	SetByCallerDamage.DataTag = GamePlayTags.Debuff_Damage;
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDamage);
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
+	Effect->Modifiers.Add(ModifierInfo);
+
+	DebuffEffectCache.Add(DebuffName, Effect);
+	return Effect;
+}
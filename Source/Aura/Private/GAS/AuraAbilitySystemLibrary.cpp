@@ -4,8 +4,10 @@
 #include "GAS/AuraAbilitySystemLibrary.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Engine/DamageEvents.h"
 #include "AuraAbilityTypes.h"
 #include "AuraGamePlayTags.h"
+#include "Game/AuraCombatantRegistry.h"
 #include "Game/AuraGameModeBase.h"
 #include "Game/LoadScreenSaveGame.h"
 #include "Interation/CombatInterface.h"
@@ -14,6 +16,9 @@
 #include "Player/AuraPlayerState.h"
 #include "UI/HUD/AuraHUD.h"
 #include "GAS/Data/AbilityInfo.h"
+#include "Algo/Sort.h"
+
+#include <algorithm>
 
 /**
  * 构建WidgetController所需的参数集
@@ -378,21 +383,17 @@ float UAuraAbilitySystemLibrary::GetDebuffFrequency(const FGameplayEffectContext
  * @return FGameplayTag       有效则返回具体 Tag；取不到时返回空 Tag
  *
  * 背景：
- * - 我们把 DamageType 用 TSharedPtr<FGameplayTag> 存在 Context 里，读取时需要先判 IsValid()。
+ * - DamageType 以 FGameplayTag 值类型内联存放在 Context 中（未设置时即为空 Tag）。
  */
 FGameplayTag UAuraAbilitySystemLibrary::GetDamageType(const FGameplayEffectContextHandle& EffectContextHandle)
 {
 	// 步骤 1：拿到扩展 Context
 	if (const FAuraGameplayEffectContext* AuraEffectContext = static_cast<const FAuraGameplayEffectContext*>(EffectContextHandle.Get())) // 转换
 	{
-		// 步骤 2：内部 Tag 指针判有效
-		if (AuraEffectContext->GetDamageType().IsValid()) // 需要先判断
-		{
-			// 步骤 3：解引用返回实际的 FGameplayTag
-			return *AuraEffectContext->GetDamageType(); // 解引用得到值
-		}
+		// 步骤 2：直接返回内联存放的 Tag
+		return AuraEffectContext->GetDamageType();
 	}
-	// 步骤 4：兜底（返回空 Tag）
+	// 步骤 3：兜底（返回空 Tag）
 	return FGameplayTag();
 }
 
@@ -647,14 +648,13 @@ void UAuraAbilitySystemLibrary::SetDebuffFrequency(FGameplayEffectContextHandle&
  * @param EffectContextHandle GE 上下文句柄
  * @param InDamageType        伤害类型（如 Fire/Physical 等）
  *
- * 说明：Context 内部以 TSharedPtr<FGameplayTag> 持有，此处新建 Shared 指针以满足接口。
+ * 说明：Context 内部以值类型内联存放，写入不产生堆分配。
  */
 void UAuraAbilitySystemLibrary::SetDamageType(FGameplayEffectContextHandle& EffectContextHandle,const FGameplayTag& InDamageType)
 {
 	if (FAuraGameplayEffectContext* AuraEffectContext = static_cast<FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
-		const TSharedPtr<FGameplayTag> DamageType = MakeShared<FGameplayTag>(InDamageType); // 构造共享指针
-		AuraEffectContext->SetDamageType(DamageType);                                       // 写入：DamageType
+		AuraEffectContext->SetDamageType(InDamageType); // 写入：DamageType
 	}
 }
 
@@ -758,6 +758,14 @@ void UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(const UObject* WorldC
 	TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius,
 	const FVector& SphereLocation)
 {
+	// 优先走存活单位注册表（空间网格，不触碰物理场景；死亡单位已注销）
+	if (UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(WorldContextObject))
+	{
+		Registry->GetCombatantsInRadius(SphereLocation, Radius, OutOverlappingActors, ActorsToIgnore);
+		return;
+	}
+
+	// 回退：注册表不可用（例如非游戏世界）时使用物理 Overlap
 	// 初始化碰撞检测参数
 	FCollisionQueryParams SphereParams;
 	// 设置需要忽略的Actor
@@ -776,19 +784,63 @@ void UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(const UObject* WorldC
 			FCollisionShape::MakeSphere(Radius),// 创建球形检测区域半径
 			SphereParams// 碰撞参数（包含忽略列表）
 			);
+		// 同一 Actor 可能有多个组件命中，用集合去重（替代 AddUnique 的线性查找）
+		TSet<AActor*> AddedActors;
+		AddedActors.Reserve(Overlaps.Num());
 		// 遍历检测结果Overlaps
 		for (FOverlapResult& Overlap: Overlaps)
 		{
+			AActor* OverlapActor = Overlap.GetActor();
 			//判断是否继承接口，并且存活
-			if (Overlap.GetActor()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(Overlap.GetActor()))
+			if (OverlapActor && OverlapActor->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(OverlapActor))
 			{
-				//添加到输出数组中
-				OutOverlappingActors.AddUnique(Overlap.GetActor());
+				bool bAlreadyAdded = false;
+				AddedActors.Add(OverlapActor, &bAlreadyAdded);
+				if (!bAlreadyAdded)
+				{
+					//添加到输出数组中
+					OutOverlappingActors.Add(OverlapActor);
+				}
 			}
 		}
+	}
+}
 
+/**
+ * @brief 解析计算径向（范围）伤害的衰减结果
+ *
+ * @param BaseDamage     内半径内的满额伤害
+ * @param MinimumDamage  外半径处的最小伤害
+ * @param Origin         伤害原点
+ * @param InnerRadius    内半径（满伤区）
+ * @param OuterRadius    外半径（超出则无伤害）
+ * @param DamageFalloff  衰减指数（1 为线性）
+ * @param TargetLocation 目标位置
+ * @return float 衰减后的伤害；超出外半径返回 0
+ *
+ * 功能说明：
+ * - 衰减系数直接复用引擎的 FRadialDamageParams::GetDamageScale，再按 AActor::InternalTakeRadialDamage 的方式
+ *   在 [MinimumDamage, BaseDamage] 之间插值，因此与 UGameplayStatics::ApplyRadialDamageWithFalloff 的曲线一致；
+ * - 不做 Overlap 查询，也不经过 TakeDamage 与委托，适合在 ExecCalc 中逐目标调用。
+ *
+ * 注意事项（与 ApplyRadialDamageWithFalloff 的行为差异）：
+ * - 距离取“原点 → 目标 Actor 位置”，而引擎取的是原点到目标最近碰撞组件命中点的距离，体积较大的目标在边缘处伤害会略低；
+ * - 没有可见性/遮挡检测（引擎会用 DamagePreventionChannel 做射线检测，被墙挡住的目标不受伤害），这里被遮挡的目标照常受伤；
+ * - 与 FRadialDamageParams::GetDamageScale 的一致性由自动化测试 Aura.GAS.RadialDamageFalloff 保证。
+ */
+float UAuraAbilitySystemLibrary::GetRadialDamageWithFalloff(float BaseDamage, float MinimumDamage, const FVector& Origin,
+	float InnerRadius, float OuterRadius, float DamageFalloff, const FVector& TargetLocation)
+{
+	const FRadialDamageParams Params(BaseDamage, MinimumDamage, InnerRadius, OuterRadius, DamageFalloff);
+	const float Distance = FVector::Dist(Origin, TargetLocation);
 
+	// 超出外半径：引擎的 Overlap 根本不会命中该目标，这里直接视为无伤害
+	if (Distance >= FMath::Max(OuterRadius, FMath::Max(0.f, InnerRadius)))
+	{
+		return 0.f;
 	}
+	const float DamageScale = Params.GetDamageScale(Distance);
+	return FMath::Lerp(MinimumDamage, BaseDamage, FMath::Max(0.f, DamageScale));
 }
 
 /**
@@ -821,31 +873,13 @@ int32 UAuraAbilitySystemLibrary::GetXPRewardForClassAndLevel(const UObject* Worl
 }
 
 /**
- * @brief 依据参数集构建并应用一次伤害型 GameplayEffect
- *
- * @param DamageEffectParams 伤害参数集（来源/目标 ASC、GE 类、等级、基础伤害、伤害类型与各类 Debuff 参数）
- * @return FGameplayEffectContextHandle 返回此次应用所用的 Effect 上下文（含施加者、来源对象等），便于受击端或 Cue 读取
+ * @brief 以来源 ASC 创建伤害用的 EffectContext，并写入参数集中的冲击/击退/范围伤害数据
  *
- * 功能说明：
- * - 将外部准备好的伤害与 Debuff 数值通过 SetByCaller 注入到 GE Spec，并在目标 ASC 上应用，实现属性变更与网络同步。
- *
- * 详细流程：
- * 1) 获取全局标签与来源 Avatar；
- * 2) 用来源 ASC 创建 EffectContext 并补充 SourceObject；
- * 3) 生成 GE Spec（类、等级、上下文）；
- * 4) 依次注入伤害与 Debuff 的 SetByCaller 数值；
- * 5) 在目标 ASC 上应用该 Spec；
- * 6) 返回 Context 供后续查询来源信息。
- *
- * 注意事项：
- * - 确保 DamageGameplayEffectClass 内读取的 SetByCaller 标签与此处一致；多人环境建议在服务器端调用（Authority）。
- * - 目标 ASC 必须有效；若 SpecHandle 无效或 GEClass 为空，将无法生效（本函数未做防御，可在调用处校验）。
+ * @param DamageEffectParams 伤害参数集
+ * @return FGameplayEffectContextHandle 填充完成的 Context（单体伤害直接使用；批量伤害作为原型复制给各目标）
  */
-FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams)
+static FGameplayEffectContextHandle MakeDamageEffectContext(const FDamageEffectParams& DamageEffectParams)
 {
-	// 获取项目统一的 GameplayTags 映射（单例），便于引用 Debuff_* 等标准标签
-	const FAuraGamePlayTags& GameplayTags = FAuraGamePlayTags::Get();
-
 	// 从来源 ASC 取到 AvatarActor（通常是 Pawn/Character）。会进入 Context，方便在执行/表现层追踪“谁造成的伤害”
 	const AActor* SourceAvatarActor = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
 
@@ -855,27 +889,31 @@ FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const
 	// 将来源对象写入 Context（这里用 Avatar 本体；也可换成武器/技能实例）。Execution Calculation 与 GameplayCue 都能读取到
 	EffectContextHandle.AddSourceObject(SourceAvatarActor);
 	//设置死亡冲击向量
-	SetDeathImpulse(EffectContextHandle,DamageEffectParams.DeathImpulse);
+	UAuraAbilitySystemLibrary::SetDeathImpulse(EffectContextHandle,DamageEffectParams.DeathImpulse);
 	//设置击退力
-	SetKnockBackForce(EffectContextHandle,DamageEffectParams.KnockBackForce);
+	UAuraAbilitySystemLibrary::SetKnockBackForce(EffectContextHandle,DamageEffectParams.KnockBackForce);
 	//设置是否为径向伤害
-	SetIsRadialDamage(EffectContextHandle,DamageEffectParams.bIsRadialDamage);
+	UAuraAbilitySystemLibrary::SetIsRadialDamage(EffectContextHandle,DamageEffectParams.bIsRadialDamage);
 	//设置径向损伤内半径
-	SetRadialDamageInnerRadius(EffectContextHandle,DamageEffectParams.RadialDamageInnerRadius);
+	UAuraAbilitySystemLibrary::SetRadialDamageInnerRadius(EffectContextHandle,DamageEffectParams.RadialDamageInnerRadius);
 	//设置径向伤害外半径
-	SetRadialDamageOuterRadius(EffectContextHandle,DamageEffectParams.RadialDamageOuterRadius);
+	UAuraAbilitySystemLibrary::SetRadialDamageOuterRadius(EffectContextHandle,DamageEffectParams.RadialDamageOuterRadius);
 	//设置径向损伤原点
-	SetRadialDamageOrigin(EffectContextHandle,DamageEffectParams.RadialDamageOrigin);
-	// 基于 GE 类、技能等级与 Context 生成“效果规格单”Spec
-	// 注意：SpecHandle 内部持有到 FGameplayEffectSpec 的共享指针；生成成功后再写入各类 SetByCaller
-	const FGameplayEffectSpecHandle SpecHandle =
-		DamageEffectParams.SourceAbilitySystemComponent->MakeOutgoingSpec(
-			DamageEffectParams.DamageGameplayEffectClass,   // 伤害型 GE 类（应在其中读取 SByC）
-			DamageEffectParams.AbilityLevel,                // 按此等级计算系数（如曲线/系数表）
-			EffectContextHandle                             // 携带来源/命中信息
-		); 
-
-	// —— 向 Spec 注入所有“动态参数”（SetByCaller），键为 GameplayTag，值为 float —— 
+	UAuraAbilitySystemLibrary::SetRadialDamageOrigin(EffectContextHandle,DamageEffectParams.RadialDamageOrigin);
+	return EffectContextHandle;
+}
+
+/**
+ * @brief 向 Spec 注入伤害与 Debuff 的全部 SetByCaller 数值（键为 GameplayTag，值为 float）
+ *
+ * @param SpecHandle         已生成的伤害 Spec
+ * @param DamageEffectParams 伤害参数集
+ */
+static void AssignDamageSetByCallerMagnitudes(const FGameplayEffectSpecHandle& SpecHandle, const FDamageEffectParams& DamageEffectParams)
+{
+	// 获取项目统一的 GameplayTags 映射（单例），便于引用 Debuff_* 等标准标签
+	const FAuraGamePlayTags& GameplayTags = FAuraGamePlayTags::Get();
+
 	// 基础伤害：键为“具体伤害类型”Tag（如 Damage.Fire），便于同一 GE 支持多种伤害通道
 	UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(SpecHandle, DamageEffectParams.DamageType, DamageEffectParams.BaseDamage);
 
@@ -890,13 +928,234 @@ FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const
 
 	// Debuff Tick 频率：通常表示“每隔多少秒触发一次”（读取端需约定语义，避免与 Hz 概念混淆）
 	UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(SpecHandle, GameplayTags.Debuff_Frequency, DamageEffectParams.DebuffFrequency); 
+}
+
+/**
+ * @brief 一次施法的伤害原型：原型 Context + 原型 Spec（已注入 SetByCaller）
+ */
+struct FAuraDamagePrototype
+{
+	//构建时的帧号（只在同一帧内复用）
+	uint64 FrameNumber = MAX_uint64;
+	//来源 ASC（弱引用，只用于比较）
+	TWeakObjectPtr<UAbilitySystemComponent> SourceAbilitySystemComponent;
+	//来源侧参数（对象指针已清空，只用于比较）
+	FDamageEffectParams SourceParams;
+	FGameplayEffectContextHandle ContextHandle;
+	FGameplayEffectSpecHandle SpecHandle;
+};
+
+/**
+ * @brief 两份参数的来源侧数据是否一致（目标 ASC 与冲击/击退向量是逐目标数据，不参与比较）
+ */
+static bool HasSameDamageSource(const FDamageEffectParams& A, const FDamageEffectParams& B)
+{
+	return A.DamageGameplayEffectClass == B.DamageGameplayEffectClass
+		&& A.AbilityLevel == B.AbilityLevel
+		&& A.BaseDamage == B.BaseDamage
+		&& A.DamageType == B.DamageType
+		&& A.DebuffChance == B.DebuffChance
+		&& A.DebuffDamage == B.DebuffDamage
+		&& A.DebuffDuration == B.DebuffDuration
+		&& A.DebuffFrequency == B.DebuffFrequency
+		&& A.bIsRadialDamage == B.bIsRadialDamage
+		&& A.RadialDamageInnerRadius == B.RadialDamageInnerRadius
+		&& A.RadialDamageOuterRadius == B.RadialDamageOuterRadius
+		&& A.RadialDamageOrigin == B.RadialDamageOrigin;
+}
+
+/**
+ * @brief 取得本次伤害的原型：同一帧内来源侧参数相同则复用，否则重新构建
+ *
+ * 功能说明：
+ * - 蓝图中的 AoE（GA_ArcaneShards、BP_FireBall 爆炸、GA_Electrocute 链式目标）在一次执行里循环调用 ApplyDamageEffect，
+ *   每个目标的来源侧参数完全相同，只有目标 ASC 与冲击/击退向量不同；
+ * - 第一个目标构建原型（MakeEffectContext、MakeOutgoingSpec 的来源捕获、五个 SetByCaller），其余目标只复制。
+ *
+ * 注意事项：
+ * - 仅在游戏线程调用（与 GE 应用本身一致）；帧号变化即失效，不会跨帧复用来源属性快照。
+ */
+static const FAuraDamagePrototype& FindOrMakeDamagePrototype(const FDamageEffectParams& DamageEffectParams)
+{
+	static FAuraDamagePrototype Prototype;
+	UAbilitySystemComponent* SourceASC = DamageEffectParams.SourceAbilitySystemComponent;
+
+	if (Prototype.FrameNumber == GFrameCounter
+		&& Prototype.SourceAbilitySystemComponent.Get() == SourceASC
+		&& Prototype.SpecHandle.IsValid()
+		&& HasSameDamageSource(Prototype.SourceParams, DamageEffectParams))
+	{
+		return Prototype;
+	}
+
+	Prototype.FrameNumber = GFrameCounter;
+	Prototype.SourceAbilitySystemComponent = SourceASC;
+	Prototype.SourceParams = DamageEffectParams;
+	Prototype.SourceParams.WorldContextObject = nullptr;
+	Prototype.SourceParams.SourceAbilitySystemComponent = nullptr;
+	Prototype.SourceParams.TargetAbilitySystemComponent = nullptr;
+
+	// 原型 Context + 原型 Spec（来源侧数据只构建一次）
+	Prototype.ContextHandle = MakeDamageEffectContext(DamageEffectParams);
+	Prototype.SpecHandle = SourceASC->MakeOutgoingSpec(
+		DamageEffectParams.DamageGameplayEffectClass,   // 伤害型 GE 类（应在其中读取 SByC）
+		DamageEffectParams.AbilityLevel,                // 按此等级计算系数（如曲线/系数表）
+		Prototype.ContextHandle);                       // 携带来源/命中信息
+	if (Prototype.SpecHandle.IsValid())
+	{
+		AssignDamageSetByCallerMagnitudes(Prototype.SpecHandle, DamageEffectParams);
+	}
+	return Prototype;
+}
+
+/**
+ * @brief 把原型复制给一个目标并应用
+ *
+ * @return FGameplayEffectContextHandle 该目标独立的 Context（ExecCalc 会写入暴击/格挡/Debuff 结果，不能在目标间共享）
+ */
+static FGameplayEffectContextHandle ApplyDamagePrototypeToTarget(const FGameplayEffectContextHandle& PrototypeContextHandle,
+	const FGameplayEffectSpecHandle& PrototypeSpecHandle, UAbilitySystemComponent* TargetASC,
+	const FVector& DeathImpulse, const FVector& KnockBackForce)
+{
+	FGameplayEffectContextHandle TargetContextHandle = PrototypeContextHandle.Duplicate();
+	UAuraAbilitySystemLibrary::SetDeathImpulse(TargetContextHandle, DeathImpulse);
+	UAuraAbilitySystemLibrary::SetKnockBackForce(TargetContextHandle, KnockBackForce);
+
+	// 复制原型 Spec（保留来源捕获与 SetByCaller），换上目标 Context 后应用
+	FGameplayEffectSpec TargetSpec(*PrototypeSpecHandle.Data);
+	TargetSpec.SetContext(TargetContextHandle, true);
+	TargetASC->ApplyGameplayEffectSpecToSelf(TargetSpec);
+	return TargetContextHandle;
+}
+
+/**
+ * @brief 依据参数集构建并应用一次伤害型 GameplayEffect
+ *
+ * @param DamageEffectParams 伤害参数集（来源/目标 ASC、GE 类、等级、基础伤害、伤害类型与各类 Debuff 参数）
+ * @return FGameplayEffectContextHandle 返回此次应用所用的 Effect 上下文（含施加者、来源对象等），便于受击端或 Cue 读取
+ *
+ * 功能说明：
+ * - 将外部准备好的伤害与 Debuff 数值通过 SetByCaller 注入到 GE Spec，并在目标 ASC 上应用，实现属性变更与网络同步。
+ *
+ * 详细流程：
+ * 1) 取得原型（同一帧内来源侧参数相同则复用，见 FindOrMakeDamagePrototype）；
+ * 2) 复制原型 Context，写入本目标的死亡冲击/击退向量；
+ * 3) 复制原型 Spec 换上该 Context，在目标 ASC 上应用；
+ * 4) 返回该目标的 Context 供后续查询来源信息。
+ *
+ * 注意事项：
+ * - 确保 DamageGameplayEffectClass 内读取的 SetByCaller 标签与此处一致；多人环境建议在服务器端调用（Authority）。
+ * - 蓝图逐目标循环调用本函数时自动走批量路径，不必改图；C++ 中已有目标列表时可直接用 ApplyDamageEffectBatch。
+ */
+FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams)
+{
+	if (DamageEffectParams.SourceAbilitySystemComponent == nullptr || DamageEffectParams.TargetAbilitySystemComponent == nullptr)
+	{
+		return FGameplayEffectContextHandle();
+	}
+
+	const FAuraDamagePrototype& Prototype = FindOrMakeDamagePrototype(DamageEffectParams);
+	if (!Prototype.SpecHandle.IsValid()) return Prototype.ContextHandle;
 
-	// 在目标 ASC 上“自施”该 Spec：返回的 ActiveHandle 可用于移除/查询（此处未保存）
 	// 网络：在服务器调用会创建可复制的 ActiveGE，同步到客户端；Context/SetByCaller 数值也随之同步
-	DamageEffectParams.TargetAbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data);
+	return ApplyDamagePrototypeToTarget(Prototype.ContextHandle, Prototype.SpecHandle, DamageEffectParams.TargetAbilitySystemComponent,
+		DamageEffectParams.DeathImpulse, DamageEffectParams.KnockBackForce);
+}
+
+/**
+ * @brief 同一份伤害参数批量作用于多个目标（AoE 专用路径）
+ *
+ * @param DamageEffectParams            伤害参数集（其中的 TargetAbilitySystemComponent 会被忽略）
+ * @param TargetAbilitySystemComponents 受击目标的 ASC 列表（允许包含 nullptr，会被跳过）
+ * @return TArray<FGameplayEffectContextHandle> 每个被成功施加的目标对应的 Context（顺序与有效目标一致）
+ *
+ * 功能说明：
+ * - 与蓝图逐目标调用 ApplyDamageEffect 共用同一个原型：构建一次 Context/Spec/SetByCaller，然后逐目标复制并应用；
+ * - 已在 C++ 中拿到目标列表时使用，省去逐目标的参数组装。
+ *
+ * 详细流程：
+ * 1) 取得原型；
+ * 2) 遍历目标：沿“冲击原点 → 目标”重新计算死亡冲击/击退方向，强度取 DeathImpulseMagnitude / KnockBackForceMagnitude；
+ * 3) 复制原型并应用到目标 ASC。
+ *
+ * 注意事项：
+ * - 冲击原点：范围伤害取 RadialDamageOrigin，否则取来源 Avatar 位置。
+ * - 方向规则与 MakeDamageEffectParamsFromClassDefaults 一致：bOverridePitch 时替换逐目标方向的 Pitch；
+ *   bOverrideKnockbackDirection / bOverrideDeathImpulse 时直接使用参数中的向量（已含 Pitch 覆盖）。
+ * - 仅应在服务器调用（Authority），与 ApplyDamageEffect 相同。
+ */
+TArray<FGameplayEffectContextHandle> UAuraAbilitySystemLibrary::ApplyDamageEffectBatch(const FDamageEffectParams& DamageEffectParams, TArrayView<UAbilitySystemComponent*> TargetAbilitySystemComponents)
+{
+	TArray<FGameplayEffectContextHandle> ContextHandles;
+	UAbilitySystemComponent* SourceASC = DamageEffectParams.SourceAbilitySystemComponent;
+	if (SourceASC == nullptr || TargetAbilitySystemComponents.Num() == 0) return ContextHandles;
+	ContextHandles.Reserve(TargetAbilitySystemComponents.Num());
+
+	// 步骤 1：原型（来源侧数据只构建一次）
+	// 句柄拷贝到本地：应用 GE 可能触发死亡等回调再次调用 ApplyDamageEffect，从而替换静态原型
+	const FAuraDamagePrototype& Prototype = FindOrMakeDamagePrototype(DamageEffectParams);
+	const FGameplayEffectContextHandle PrototypeContextHandle = Prototype.ContextHandle;
+	const FGameplayEffectSpecHandle PrototypeSpecHandle = Prototype.SpecHandle;
+	if (!PrototypeSpecHandle.IsValid()) return ContextHandles;
+
+	// 冲击原点与强度（方向逐目标计算）
+	const AActor* SourceAvatarActor = SourceASC->GetAvatarActor();
+	const FVector ImpulseOrigin = DamageEffectParams.bIsRadialDamage || SourceAvatarActor == nullptr
+		? DamageEffectParams.RadialDamageOrigin
+		: SourceAvatarActor->GetActorLocation();
+
+	for (UAbilitySystemComponent* TargetASC : TargetAbilitySystemComponents)
+	{
+		if (TargetASC == nullptr) continue;
+
+		// 步骤 2：沿原点→目标重新计算冲击方向（目标与原点重合或方向被覆写时沿用参数中的原始向量）
+		FVector DeathImpulse = DamageEffectParams.DeathImpulse;
+		FVector KnockBackForce = DamageEffectParams.KnockBackForce;
+		if (const AActor* TargetAvatarActor = TargetASC->GetAvatarActor())
+		{
+			const FVector ToTarget = (TargetAvatarActor->GetActorLocation() - ImpulseOrigin).GetSafeNormal();
+			if (!ToTarget.IsZero())
+			{
+				FRotator Rotation = ToTarget.Rotation();
+				if (DamageEffectParams.bOverridePitch)
+				{
+					Rotation.Pitch = DamageEffectParams.PitchOverride; // 覆盖 Pitch（例如把目标向上击飞）
+				}
+				const FVector Direction = Rotation.Vector();
+				if (!DamageEffectParams.bOverrideDeathImpulse)
+				{
+					DeathImpulse = Direction * DamageEffectParams.DeathImpulseMagnitude;
+				}
+				if (!DamageEffectParams.bOverrideKnockbackDirection)
+				{
+					KnockBackForce = Direction * DamageEffectParams.KnockBackForceMagnitude;
+				}
+			}
+		}
+
+		// 步骤 3：复制原型并应用
+		ContextHandles.Add(ApplyDamagePrototypeToTarget(PrototypeContextHandle, PrototypeSpecHandle, TargetASC, DeathImpulse, KnockBackForce));
+	}
+	return ContextHandles;
+}
 
-	// 返回 Context：受击端、Cue 或日志系统可据此获取施加者、武器等来源信息
-	return EffectContextHandle; 
+/**
+ * @brief ApplyDamageEffectBatch 的蓝图入口：把目标 Actor 列表转换为 ASC 列表后批量应用
+ *
+ * @param DamageEffectParams 伤害参数集
+ * @param TargetActors       受击目标（无 ASC 的 Actor 会被跳过）
+ */
+void UAuraAbilitySystemLibrary::ApplyDamageEffectToActors(const FDamageEffectParams& DamageEffectParams, const TArray<AActor*>& TargetActors)
+{
+	TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+	for (AActor* TargetActor : TargetActors)
+	{
+		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor))
+		{
+			TargetASCs.Add(TargetASC);
+		}
+	}
+	ApplyDamageEffectBatch(DamageEffectParams, TargetASCs);
 }
 
 /**
@@ -1025,71 +1284,76 @@ FPredictionKey UAuraAbilitySystemLibrary::AuraGetPredictionKeyFromSpec_Safe(cons
 	return Spec.ActivationInfo.GetActivationPredictionKey(); // 兼容层：避免在极端情况下拿不到键
 }
 
+namespace AuraClosestTargets
+{
+	/**
+	 * @brief K 近邻选择的公共实现（两个 GetClosestTargets 重载共用）
+	 *
+	 * 详细流程：
+	 * 1. 一次遍历把每个有效候选的“平方距离”写入临时缓冲（距离与下标分开存放，SoA），无需开方；
+	 * 2. 候选多于 K 个时用 nth_element 把最近的 K 个划分到前面（平均 O(N)）；
+	 * 3. 只对这 K 个按距离排序，距离相同按输入顺序，结果稳定可复现。
+	 *
+	 * 注意事项：
+	 * - 临时缓冲使用内联分配器，常见的几十个候选不会产生堆分配；
+	 * - 跳过 nullptr；输入中的重复 Actor 不会被去重（调用方的候选来自去重后的查询）。
+	 */
+	template<typename AllocatorType>
+	static void Select(int32 MaxTargets, TArrayView<AActor* const> Actors, TArray<AActor*, AllocatorType>& OutClosestTargets, const FVector& Origin)
+	{
+		OutClosestTargets.Reset();
+		if (MaxTargets <= 0 || Actors.Num() == 0) return;
+
+		TArray<double, TInlineAllocator<32>> DistancesSquared;
+		TArray<int32, TInlineAllocator<32>> Candidates;
+		DistancesSquared.SetNumUninitialized(Actors.Num());
+		Candidates.Reserve(Actors.Num());
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
+		{
+			if (Actors[Index] == nullptr) continue;
+			DistancesSquared[Index] = FVector::DistSquared(Actors[Index]->GetActorLocation(), Origin);
+			Candidates.Add(Index);
+		}
+
+		const auto IsCloser = [&DistancesSquared](int32 A, int32 B)
+		{
+			return DistancesSquared[A] < DistancesSquared[B] || (DistancesSquared[A] == DistancesSquared[B] && A < B);
+		};
+
+		const int32 NumResults = FMath::Min(MaxTargets, Candidates.Num());
+		if (NumResults < Candidates.Num())
+		{
+			std::nth_element(Candidates.GetData(), Candidates.GetData() + NumResults, Candidates.GetData() + Candidates.Num(), IsCloser);
+		}
+		Algo::Sort(MakeArrayView(Candidates.GetData(), NumResults), IsCloser);
+
+		OutClosestTargets.Reserve(NumResults);
+		for (int32 Rank = 0; Rank < NumResults; ++Rank)
+		{
+			OutClosestTargets.Add(Actors[Candidates[Rank]]);
+		}
+	}
+}
+
 /**
  * @brief 从一组 Actor 中，按与给定点 Origin 的距离“由近到远”挑出最多 MaxTargets 个目标
  *
  * @param MaxTargets            需要返回的最近目标上限（K）
  * @param Actors                候选目标列表（未做去重/排序）
- * @param OutClosestTargets     输出：距离最近的最多 K 个 Actor（不更改输入 Actors）
+ * @param OutClosestTargets     输出：距离最近的最多 K 个 Actor，按距离由近到远排列（会先清空）
  * @param Origin                计算距离的参考点（通常是释放者/鼠标命中点/技能中心点）
  *
- * 功能说明：
- * - 采用“逐次选择（Selection）”法：每轮从剩余候选里找到一个最近者，加入结果并从候选中移除，重复 K 次。
- * - 不改变原始 Actors 顺序；内部复制到临时数组，再逐步删除已选目标。
- *
- * 复杂度与适用性：
- * - 时间复杂度约 O(N*K)（N 为 Actors 数量），当 K ≪ N 时比较合适；若 K 接近 N，建议一次排序 O(N log N) 或用“平方距离”+ partial sort。
- *
- * 注意事项（边界）：
- * - 代码假定 Actors 中元素有效（非 nullptr），且可安全调用 GetActorLocation()；若存在 nullptr，需在循环中跳过以免崩溃（见“建议”）。
- * - 这里用 Length() 触发 sqrt，性能一般；可改用“平方距离”比较以避免开方（见“建议”）。
- * - 若 Actors 数量 ≤ MaxTargets，将直接把 Actors 全量拷贝到输出（不排序）。
+ * 复杂度：
+ * - 平均 O(N + K log K)，只计算一次平方距离；实现见 AuraClosestTargets::Select。
  */
 void UAuraAbilitySystemLibrary::GetClosestTargets(int32 MaxTargets, const TArray<AActor*>& Actors, TArray<AActor*>& OutClosestTargets, const FVector& Origin)
 {
-	// 若候选数量本就不超过上限，直接返回所有候选（不排序，保持原顺序）
-	if (Actors.Num() <= MaxTargets)
-	{
-		OutClosestTargets = Actors;    // 直接拷贝（浅拷贝指针），省去后续计算
-		return;                        // 提前返回
-	}
-
-	// 拷贝一份待检查的候选数组（避免改动传入的 Actors）
-	TArray<AActor*> ActorsToCheck = Actors; 
-	// 已选目标计数
-	int32 NumTargetsFound = 0;
-
-	// 迭代选择，直到找到 K 个或者候选耗尽
-	while (NumTargetsFound < MaxTargets)
-	{
-		// 候选用尽，提前结束（防越界）
-		if (ActorsToCheck.Num() == 0) break;
-
-		// 以“无穷大”初始化本轮的最近距离，用 double 存放
-		double ClosestDistance = TNumericLimits<double>::Max();
-		// 本轮找到的最近 Actor（注意：未显式初始化，理论上必须在循环中被赋值；见“建议”）
-		AActor* ClosestActor;
-
-		// 遍历当前所有候选，寻找与 Origin 最近的一个
-		for (AActor* PotentialTarget : ActorsToCheck)
-		{
-			// 计算欧式距离（会开方，性能相对慢；可改用平方长度比较以优化）
-			const double Distance = (PotentialTarget->GetActorLocation() - Origin).Length();
-			// 若更近，则更新“最优解”
-			if (Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;      // 记录更小的距离
-				ClosestActor = PotentialTarget;  // 记录对应的最近目标
-			}
-		}
+	AuraClosestTargets::Select(MaxTargets, MakeArrayView(Actors), OutClosestTargets, Origin);
+}
 
-		// 从候选集中移除本轮已选中的 Actor（避免下一轮重复选中）
-		ActorsToCheck.Remove(ClosestActor);
-		// 将最近者加入输出（AddUnique 防止重复）
-		OutClosestTargets.AddUnique(ClosestActor);
-		// 已选数量 +1
-		++NumTargetsFound;
-	}
+void UAuraAbilitySystemLibrary::GetClosestTargets(int32 MaxTargets, TArrayView<AActor* const> Actors, TArray<AActor*, TInlineAllocator<8>>& OutClosestTargets, const FVector& Origin)
+{
+	AuraClosestTargets::Select(MaxTargets, Actors, OutClosestTargets, Origin);
 }
 
 
@@ -1232,23 +1496,21 @@ void UAuraAbilitySystemLibrary::SetTargetEffectParamsASC(FDamageEffectParams& Da
  * @param SecondActor 第二个角色
  * @return bool 结果：true=敌对（不是朋友），false=朋友
  * @details
- *  - 如果两个都是 Player，说明是队友 → 返回 false
- *  - 如果两个都是 Enemy，说明是同阵营 → 返回 false
- *  - 其他情况 → 不是朋友 → 返回 true
+ *  - 取双方阵营后查 FAuraTeamRelations 的敌对掩码（一次位与），不再逐个扫描 Actor 标签；
+ *  - 同为 Player 或同为 Enemy → 朋友；未分配阵营（None）与任何一方都视为“不是朋友”。
  */
 bool UAuraAbilitySystemLibrary::IsNotFriend(AActor* FirstActor, AActor* SecondActor)
 {
-	// 是否都是玩家
-	const bool bBothArePlayers = FirstActor->ActorHasTag(FName("Player")) && SecondActor->ActorHasTag(FName("Player"));
-	
-	// 是否都是敌人
-	const bool bBothAreEnemies = FirstActor->ActorHasTag(FName("Enemy")) && SecondActor->ActorHasTag(FName("Enemy"));
-	
-	// 好友关系：同为玩家 或 同为敌人
-	const bool bFriends = bBothArePlayers || bBothAreEnemies;
-	
-	// 返回“不是朋友”
-	return !bFriends;
+	return FAuraTeamRelations::AreHostile(GetActorTeam(FirstActor), GetActorTeam(SecondActor));
+}
+
+EAuraTeam UAuraAbilitySystemLibrary::GetActorTeam(const AActor* Actor)
+{
+	if (const ICombatInterface* CombatInterface = Cast<ICombatInterface>(Actor))
+	{
+		return CombatInterface->GetTeam();
+	}
+	return EAuraTeam::None;
 }
 
 
@@ -9,12 +9,12 @@
 #include "GameplayEffectExtension.h"
 #include "Aura/AuraLogChannels.h"
 #include "GameFramework/Character.h"
+#include "GAS/AuraAbilitySystemGlobals.h"
 #include "GAS/AuraAbilitySystemLibrary.h"
 #include "Interation/CombatInterface.h"
 #include "Interation/PlayerInterface.h"
 #include "Net/UnrealNetwork.h"
 #include "Player/AuraPlayerController.h"
-#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
 
 UAuraAttributeSet::UAuraAttributeSet()
 {
@@ -328,28 +328,23 @@ void UAuraAttributeSet::HandleIncomingXP(const FEffectProperties& Props)
 }
 
 /**
- * @brief 从上游 EffectContext 读取 Debuff 参数，动态创建“周期伤害（DoT）”GE 并施加到 TargetASC
+ * @brief 从上游 EffectContext 读取 Debuff 参数，取得（缓存的）“周期伤害（DoT）”GE 并施加到 TargetASC
  * @param Props 作用参数集合（SourceASC/TargetASC、SourceAvatarActor、EffectContextHandle 等）
  * @return void 无返回（副作用：向 TargetASC 应用一个有持续时间、按周期触发的 UGameplayEffect）
  *
  * 背景知识（UE/GAS）：
  * - UGameplayEffect（GE）是“配方”，FGameplayEffectSpec（Spec）是“处方实例”；Period>0 表示按固定时间间隔触发周期逻辑。
  * - 默认情况下，GE 的周期逻辑会在应用时立刻执行一次（bExecutePeriodicEffectOnApplication=true）；若想“首跳延后”，需设为 false。
- * - **Modifiers**（修饰器）是“立即生效”的属性改动：GE 一应用就对 Attribute 产生影响；与“周期触发”无关。
- * - 典型 DoT 推荐用 **Execution**（UGameplayEffectExecutionCalculation）在每个周期里结算伤害，而不是用 Modifier 直接加伤害。
  *
  * 详细流程：
  * 1) 从单例获取项目 GameplayTags；用 SourceASC 创建 EffectContext，并记录 SourceAvatarActor 为 SourceObject。
  * 2) 从 Props.EffectContextHandle 读取 DamageType / DebuffDamage / DebuffDuration / DebuffFrequency。
- * 3) New 一个临时 GE：配置 Duration/Period，并将 bExecutePeriodicEffectOnApplication 设为 false（首跳延后）。
- * 4) 通过 UTargetTagsGameplayEffectComponent 给目标添加 Debuff 相关 Tag；设置叠加策略与上限。
- * 5) 向 GE 添加一个对 IncomingDamage 的 Modifier（当前写法：立刻对伤害做加法，注意这会“应用即生效”）。
- * 6) new 一个 FGameplayEffectSpec，向自定义 Context 回写 DamageType，并将 Spec 施加到 TargetASC。
+ * 3) 通过 UAuraAbilitySystemGlobals::FindOrCreateDebuffEffect 取得按（伤害类型, 持续时间, 频率）缓存的 GE 定义。
+ * 4) 在栈上构造 FGameplayEffectSpec，以 SetByCaller（Debuff.Damage）写入每跳伤害，向自定义 Context 回写 DamageType，并施加到 TargetASC。
  *
  * 注意事项：
- * - 即使 bExecutePeriodicEffectOnApplication=false，也**无法阻止 Modifier 的“即时生效”**——这正是你看到“刚应用就跳伤害”的根因之一。
- * - 若希望“首跳严格在 1 秒后”，请不要用 Modifier 对伤害直接加值，改为在 **Execution** 中按周期结算（见本文后“修复思路”）。
- * - DamageTypesToDebuffs[DamageType] 使用前应确保映射存在；DebuffFrequency>0、DebuffDuration>=0 建议做边界检查。
+ * - GE 定义被缓存复用，不再每次触发都 NewObject；Spec 为栈对象，ApplyGameplayEffectSpecToSelf 内部会自行拷贝。
+ * - 伤害类型没有对应 Debuff 映射时直接返回。
  */
 void UAuraAttributeSet::Debuff(const FEffectProperties& Props)
 {
@@ -374,87 +369,23 @@ void UAuraAttributeSet::Debuff(const FEffectProperties& Props)
 	// 读取周期间隔（秒/次）
 	const float DebuffFrequency = UAuraAbilitySystemLibrary::GetDebuffFrequency(Props.EffectContextHandle);
 
-	// 拼接临时 GE 的可读名称（便于日志/调试）
-	FString DebuffName = FString::Printf(TEXT("DynamicDebuff_%s"),*DamageType.ToString());
+	// 取得缓存的 Debuff GE 定义（不存在则创建一次）
+	UAuraAbilitySystemGlobals& AuraGlobals = static_cast<UAuraAbilitySystemGlobals&>(UAbilitySystemGlobals::Get());
+	UGameplayEffect* Effect = AuraGlobals.FindOrCreateDebuffEffect(DamageType, DebuffDuration, DebuffFrequency);
+	if (Effect == nullptr) return;
 
-	// 在 Transient 包中创建一次性 UGameplayEffect（仅供本次应用）
-	UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(DebuffName));
+	// 栈上构造 Spec，等级 1.f；用缓存的 Effect 与 Context
+	FGameplayEffectSpec DebuffSpec(Effect, EffectContext, 1.f);
 
-	// 设置为“有持续时间”的 GE
-	Effect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	// 每跳伤害通过 SetByCaller 传入（GE 定义中的 Modifier 读取 Debuff.Damage）
+	DebuffSpec.SetSetByCallerMagnitude(GamePlayTags.Debuff_Damage, DebuffDamage);
 
-	// 设置周期间隔（>0 才会周期触发）
-	Effect->Period = DebuffFrequency;
+	// 回写 DamageType 到 Context（下游读取一致）
+	FAuraGameplayEffectContext* AuraContext = static_cast<FAuraGameplayEffectContext*>(DebuffSpec.GetContext().Get());
+	AuraContext->SetDamageType(DamageType);
 
-	// 设置持续时间（可伸缩浮点包装）
-	Effect->DurationMagnitude = FScalableFloat(DebuffDuration);
-
-	// 关键：首跳不在应用瞬间执行（仅对“周期执行体/Execution”生效；对 Modifier 不起作用）
-	Effect->bExecutePeriodicEffectOnApplication = false;  
-
-	// 构造目标标签容器（通过组件式 API 添加到目标）
-	FInheritedTagContainer TagContainer = FInheritedTagContainer();
-	
-	// 找到或添加 UTargetTagsGameplayEffectComponent（用来操作目标的 Tag 变化）
-	UTargetTagsGameplayEffectComponent& Component = Effect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>();
-
-
-	const FGameplayTag DebuffTag = GamePlayTags.DamageTypesToDebuffs[DamageType];
-	// 将“伤害类型 → Debuff 标签”的映射结果加入容器
-	TagContainer.Added.AddTag(DebuffTag);
-	// 如果Debuff标签为 晕眩 时
-	if (DebuffTag.MatchesTagExact(GamePlayTags.Debuff_Stun))
-	{
-		//将“ 阻止光标追踪，移动，输入已按下，输入已松开等 Debuff 标签”的映射结果加入容器，阻止这些效果 
-		TagContainer.Added.AddTag(GamePlayTags.Player_Block_CursorTrace);
-		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputHeld);
-		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputPressed);
-		TagContainer.Added.AddTag(GamePlayTags.Player_Block_InputReleased);
-	}
-	
-	
-	// 应用到目标标签（使目标获得对应的 Debuff Tag）
-	Component.SetAndApplyTargetTagChanges(TagContainer);
-
-	// 叠加策略：同一来源聚合
-	Effect->StackingType = EGameplayEffectStackingType::AggregateBySource;
-
-	// 限制最大叠加层数为 1
-	Effect->StackLimitCount = 1;
-
-	// 记录修饰器数组当前尾索引
-	const int32 Index = Effect->Modifiers.Num();                          
-
-	// 向 GE 追加一条默认修饰器（FGameplayModifierInfo）
-	Effect->Modifiers.Add(FGameplayModifierInfo());                    
-
-	// 引用刚刚加入的修饰器
-	FGameplayModifierInfo& ModifierInfo = Effect->Modifiers[Index];      
-	
-	// 设置修饰器幅度 = 每跳伤害（注意：Modifier 会在“应用时立刻生效”，与周期无关）
-	ModifierInfo.ModifierMagnitude = FScalableFloat(DebuffDamage);
-
-	// 修饰器为加法叠加
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-
-	// 修饰的目标属性是 IncomingDamage（常见做法：作为即将结算的伤害池）
-	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
-
-	// 构造一个 FGameplayEffectSpec（实例），等级 1.f；用前面的 Effect 与 Context
-	if (FGameplayEffectSpec* MutableSpec = new FGameplayEffectSpec(Effect, EffectContext, 1.f)) 
-	{
-		// 从 Spec 获取我们扩展的 FAuraGameplayEffectContext 指针
-		FAuraGameplayEffectContext* AuraContext = static_cast<FAuraGameplayEffectContext*>(MutableSpec->GetContext().Get());
-	
-		// 准备共享指针包装的 DamageType（匹配 Context 字段类型）
-		TSharedPtr<FGameplayTag> DebuffDamageType = MakeShareable(new FGameplayTag(DamageType));
-
-		// 回写 DamageType 到 Context（下游读取一致）
-		AuraContext->SetDamageType(DebuffDamageType);
-
-		// 对 TargetASC 应用该 Spec（GE 生效：Modifier 立即作用；周期逻辑将从下一个周期点开始）
-		Props.TargetASC->ApplyGameplayEffectSpecToSelf(*MutableSpec);
-	}
+	// 对 TargetASC 应用该 Spec（周期逻辑将从下一个周期点开始）
+	Props.TargetASC->ApplyGameplayEffectSpecToSelf(DebuffSpec);
 }
 
 void UAuraAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
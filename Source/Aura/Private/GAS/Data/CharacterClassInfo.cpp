@@ -8,3 +8,95 @@ FCharacterClassDefaultInfo UCharacterClassInfo::GetClassDefault(ECharacterClass
 	// 使用 FindChecked 确保 CharacterClass 存在，否则会触发断言
 	return CharacterClassInformation.FindChecked(CharacterClass);
 }
+
+/**
+ * @brief 将曲线按整数等级烘焙到数组：下标 0 ~ 曲线最后一个关键帧所在等级
+ *
+ * @param InCurve 原始曲线（为空时清空缓存，读取返回 0）
+ */
+void FDamageCalculationCoefficients::FBakedCurve::Bake(const FRealCurve* InCurve)
+{
+	Curve = InCurve;
+	Values.Reset();
+	if (Curve == nullptr || Curve->GetNumKeys() == 0) return;
+
+	float MinTime = 0.f;
+	float MaxTime = 0.f;
+	Curve->GetTimeRange(MinTime, MaxTime);
+	const int32 MaxLevel = FMath::Max(FMath::CeilToInt(MaxTime), 0);
+
+	Values.SetNumUninitialized(MaxLevel + 1);
+	for (int32 Level = 0; Level <= MaxLevel; ++Level)
+	{
+		Values[Level] = Curve->Eval(Level);
+	}
+}
+
+/**
+ * @brief 获取伤害计算系数缓存
+ *
+ * 注意事项：
+ * - 缓存为惰性构建：首次访问（或曲线表变更导致失效后）才烘焙；
+ * - 超出烘焙范围的等级由 FBakedCurve 回退为曲线插值，结果与直接 Eval 一致。
+ */
+const FDamageCalculationCoefficients& UCharacterClassInfo::GetDamageCalculationCoefficients() const
+{
+	if (!bCoefficientsBaked)
+	{
+		BakeDamageCalculationCoefficients();
+	}
+	return CachedCoefficients;
+}
+
+void UCharacterClassInfo::PostLoad()
+{
+	Super::PostLoad();
+	BakeDamageCalculationCoefficients();
+#if WITH_EDITOR
+	BindCurveTableChanged();
+#endif
+}
+
+void UCharacterClassInfo::BakeDamageCalculationCoefficients() const
+{
+	const UCurveTable* CurveTable = DamageCalculationCoefficientes;
+	const FString Context;
+	CachedCoefficients.ArmorPen.Bake(CurveTable ? CurveTable->FindCurve(FName("ArmorPenetration"), Context) : nullptr);
+	CachedCoefficients.EffectiveArmor.Bake(CurveTable ? CurveTable->FindCurve(FName("EffectiveArmor"), Context) : nullptr);
+	CachedCoefficients.CriticalHitResistance.Bake(CurveTable ? CurveTable->FindCurve(FName("CriticalHitResistance"), Context) : nullptr);
+	bCoefficientsBaked = true;
+}
+
+void UCharacterClassInfo::InvalidateDamageCalculationCoefficients()
+{
+	// 曲线表重新导入后原曲线指针也会失效，一并清空，等下次访问时重新烘焙
+	CachedCoefficients = FDamageCalculationCoefficients();
+	bCoefficientsBaked = false;
+}
+
+#if WITH_EDITOR
+void UCharacterClassInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCharacterClassInfo, DamageCalculationCoefficientes))
+	{
+		InvalidateDamageCalculationCoefficients();
+		BindCurveTableChanged();
+	}
+}
+
+void UCharacterClassInfo::BindCurveTableChanged()
+{
+	// 先解绑旧曲线表，再绑定当前曲线表的变更事件（重新导入时触发）
+	if (UCurveTable* OldTable = BoundCurveTable.Get())
+	{
+		OldTable->OnCurveTableChanged().Remove(CurveTableChangedHandle);
+	}
+	CurveTableChangedHandle.Reset();
+	BoundCurveTable = DamageCalculationCoefficientes;
+	if (DamageCalculationCoefficientes)
+	{
+		CurveTableChangedHandle = DamageCalculationCoefficientes->OnCurveTableChanged().AddUObject(this, &UCharacterClassInfo::InvalidateDamageCalculationCoefficients);
+	}
+}
+#endif
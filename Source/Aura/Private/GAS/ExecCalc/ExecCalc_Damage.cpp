@@ -9,7 +9,6 @@
 #include "GAS/AuraAttributeSet.h"
 #include "GAS/Data/CharacterClassInfo.h"
 #include "Interation/CombatInterface.h"
-#include "Kismet/GameplayStatics.h"
 
 
 /**
@@ -46,6 +45,9 @@ struct AuraDamageStatics
 	// 声明“物理抗性”捕获定义
 	DECLARE_ATTRIBUTE_CAPTUREDEF(PhysicalResistance);
 
+	// 按伤害类型稠密索引排列的抗性捕获定义（与 FAuraGamePlayTags::DamageTypeInfos 下标一致）
+	FGameplayEffectAttributeCaptureDefinition ResistanceDefs[EAuraDamageTypeIndex::Num];
+
 	// 构造时完成具体捕获规则的定义（指定属性集/来源端/是否快照）
 	AuraDamageStatics()
 	{
@@ -78,6 +80,12 @@ struct AuraDamageStatics
 
 		// 目标端读取“物理抗性”，执行时读取（非快照）
 		DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, PhysicalResistance, Target, false);
+
+		// 抗性捕获定义按伤害类型索引平铺，执行期直接下标访问
+		ResistanceDefs[EAuraDamageTypeIndex::Fire]      = FireResistanceDef;
+		ResistanceDefs[EAuraDamageTypeIndex::Lightning] = LightningResistanceDef;
+		ResistanceDefs[EAuraDamageTypeIndex::Arcane]    = ArcaneResistanceDef;
+		ResistanceDefs[EAuraDamageTypeIndex::Physical]  = PhysicalResistanceDef;
 	}
 };
 
@@ -111,118 +119,78 @@ UExecCalc_Damage::UExecCalc_Damage()
 /**
  * @brief 自定义伤害执行：根据伤害类型与目标抗性判定减益触发概率
  *
- * @param ExecutionParams 执行期上下文（源/目标 ASC、已捕获属性、Spec 等）
- * @param Spec            本次执行所属的 GE 规格（包含 SetByCaller、捕获快照、标签聚合等）
- * @param EvaluateParameters 捕获求值所需的标签上下文（源/目标聚合标签）
- * @param InTagsToDefs    标签到属性捕获定义的映射（用于按标签读取已捕获的属性）
+ * @param Spec                   本次执行所属的 GE 规格（包含 SetByCaller 等）
+ * @param DamageTypeIndex        伤害类型稠密索引（EAuraDamageTypeIndex）
+ * @param TargetDebuffResistance 目标对该伤害类型的抗性（调用方已捕获并求值，避免重复捕获）
  *
  * 功能说明：
- * - 针对每种伤害类型：读取该类型的 SetByCaller 伤害值，如果存在则按“来源减益几率”与“目标对应抗性”计算有效减益概率；
- * - 随机判定是否触发对应的 Debuff（如灼烧/感电/流血等）；触发时应附加后续处理（此处预留 if 分支）。
+ * - 按“来源减益几率”与“目标对应抗性”计算有效减益概率；
+ * - 随机判定是否触发对应的 Debuff（如灼烧/感电/流血等），触发时把 Debuff 参数写入 Context。
  *
  * 注意事项：
- * - 读取 SetByCaller 时使用默认值 -1 表示“未设置”，通过阈值判断过滤；
- * - 目标抗性捕获值建议下限为 0，上限可按需要 Clamp 到 100；
- * - 触发后应在 if(bDebuff) 内附加 GE/标签或写入输出（当前留空待接入具体 Debuff 逻辑）。
+ * - 只应对本次 Spec 中确实设置了该伤害类型 SetByCaller 的类型调用；
+ * - 目标抗性下限为 0（可按需要 Clamp 到 100）。
  */
-void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
-                                       const FGameplayEffectSpec& Spec,
-                                       FAggregatorEvaluateParameters EvaluateParameters,
-                                       const TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition>& InTagsToDefs) const
+void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectSpec& Spec,
+                                       int32 DamageTypeIndex,
+                                       float TargetDebuffResistance) const
 {
-	// 获取全局标签（包含 伤害类型->Debuff、伤害类型->抗性 映射）
+	// 获取全局标签（包含 Debuff 参数标签与伤害类型信息表）
 	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	const FAuraDamageTypeInfo& DamageTypeInfo = GamePlayTags.DamageTypeInfos[DamageTypeIndex];
 
-	// 遍历“伤害类型 -> Debuff类型”的映射，逐一判定是否触发 Debuff
-	for (TTuple<FGameplayTag, FGameplayTag> Pair : GamePlayTags.DamageTypesToDebuffs)
-	{
-		// 当前伤害类型与其对应的 Debuff 类型
-		const FGameplayTag& DamageType = Pair.Key;
-		const FGameplayTag& DebuffType = Pair.Value;
-
-		// 读取该伤害类型的 SetByCaller 数值（未设置时返回 -1）
-		const float TypeDamage = Spec.GetSetByCallerMagnitude(DamageType, false, -1.f);
-
-		// 只有当该类型伤害存在（> -0.5 视为有效）时才参与 Debuff 判定
-		if (TypeDamage > -0.5f)
-		{
-			// 来源配置的基础 Debuff 触发概率（百分比，来自 SetByCaller）
-			const float SourceDebuffChance = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Chance, false, -1.f);
-
-			// 目标对应的“该伤害类型的抗性”标签（例如 火伤->火抗）
-			float TargetDebuffResistance = 0.f;
-			const FGameplayTag& ResistanceTag = GamePlayTags.DamageTypesToResistance[DamageType];
-
-			// 通过捕获定义计算目标抗性数值（依赖 InTagsToDefs 的映射）
-			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(InTagsToDefs[ResistanceTag], EvaluateParameters, TargetDebuffResistance);
+	// 来源配置的基础 Debuff 触发概率（百分比，来自 SetByCaller）
+	const float SourceDebuffChance = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Chance, false, -1.f);
 
-			// 抗性不低于 0（可按需要再 Clamp 到 100）
-			TargetDebuffResistance = FMath::Max<float>(TargetDebuffResistance, 0.f);
+	// 抗性不低于 0（可按需要再 Clamp 到 100）
+	TargetDebuffResistance = FMath::Max<float>(TargetDebuffResistance, 0.f);
 
-			// 有效触发概率 = 基础概率 * (100 - 抗性) / 100
-			const float EffectiveDebuffChance = SourceDebuffChance * (100.f - TargetDebuffResistance) / 100.f;
+	// 有效触发概率 = 基础概率 * (100 - 抗性) / 100
+	const float EffectiveDebuffChance = SourceDebuffChance * (100.f - TargetDebuffResistance) / 100.f;
 
-			// 随机判定是否触发（百分制，含端点时可用 <=）
-			const bool bDebuff = FMath::RandRange(1, 100) < EffectiveDebuffChance;
+	// 随机判定是否触发（百分制，含端点时可用 <=）
+	const bool bDebuff = FMath::RandRange(1, 100) < EffectiveDebuffChance;
 
-			// 触发后：在此附加 Debuff（如应用 DoT GE、添加状态标签等）——留给具体项目逻辑接入
-			if (bDebuff)
-			{
-				FGameplayEffectContextHandle ContextHandle = Spec.GetContext();
-				UAuraAbilitySystemLibrary::SetIsSuccessfulDebuff(ContextHandle, true);
-				UAuraAbilitySystemLibrary::SetDamageType(ContextHandle, DamageType);
+	// 触发后：把 Debuff 参数写入 Context，由 AttributeSet 在受击时施加
+	if (bDebuff)
+	{
+		FGameplayEffectContextHandle ContextHandle = Spec.GetContext();
+		UAuraAbilitySystemLibrary::SetIsSuccessfulDebuff(ContextHandle, true);
+		UAuraAbilitySystemLibrary::SetDamageType(ContextHandle, DamageTypeInfo.DamageType);
 
-				const float DebuffDamage = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Damage, false, -1.f);
-				const float DebuffDuration = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Duration, false, -1.f);
-				const float DebuffFrequency = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Frequency, false, -1.f);
+		const float DebuffDamage = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Damage, false, -1.f);
+		const float DebuffDuration = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Duration, false, -1.f);
+		const float DebuffFrequency = Spec.GetSetByCallerMagnitude(GamePlayTags.Debuff_Frequency, false, -1.f);
 
-				UAuraAbilitySystemLibrary::SetDebuffDamage(ContextHandle, DebuffDamage);
-				UAuraAbilitySystemLibrary::SetDebuffDuration(ContextHandle, DebuffDuration);
-				UAuraAbilitySystemLibrary::SetDebuffFrequency(ContextHandle, DebuffFrequency);
-			}
-		}
+		UAuraAbilitySystemLibrary::SetDebuffDamage(ContextHandle, DebuffDamage);
+		UAuraAbilitySystemLibrary::SetDebuffDuration(ContextHandle, DebuffDuration);
+		UAuraAbilitySystemLibrary::SetDebuffFrequency(ContextHandle, DebuffFrequency);
 	}
 }
 
 /**
- * @brief 伤害执行计算入口：组装捕获映射、构造评估上下文，计算格挡/护甲/抗性/暴击并输出最终伤害
+ * @brief 伤害执行计算入口：构造评估上下文，计算减益/抗性/格挡/护甲/暴击并输出最终伤害
  *
  * @param ExecutionParams 执行期上下文（包含源/目标 ASC、捕获快照、Owning Spec 等）
  * @param OutExecutionOutput 执行输出容器（把最终伤害写入 IncomingDamage 等属性）
  *
  * 功能说明：
- * - 建立标签到捕获定义的映射，获取源/目标 ASC 与 Avatar 和等级；
+ * - 获取源/目标 ASC 与 Avatar 和等级；
  * - 从 Spec 中取聚合标签、SetByCaller 值，组装 EvaluateParameters；
- * - 调用 DetermineDebuff 进行减益判定；
- * - 逐个伤害类型叠加伤害（考虑目标对应抗性），再计算格挡、护甲与护甲穿透、暴击，最后写入输出。
+ * - 按伤害类型稠密索引遍历（FAuraGamePlayTags::DamageTypeInfos）：每种类型只捕获一次抗性，
+ *   同时用于 Debuff 判定与伤害衰减；无需逐次构建 TMap 或做哈希查找；
+ * - 再计算格挡、护甲与护甲穿透、暴击，最后写入输出。
  *
  * 注意事项：
- * - TagsToCaptureDefs 的定义需与 AttributeSet 捕获注册一致（名称/来源/目标/快照时机）；
+ * - DamageStatics().ResistanceDefs 的下标需与 EAuraDamageTypeIndex 保持一致；
  * - 读取曲线前请确保指针有效；概率相关比较建议考虑端点（<= 以覆盖 100% 场景）。
  */
 void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
                                               FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
-	// 1) 建立 “标签 -> 捕获定义” 映射（护甲/穿透/格挡/暴击/抗性等）
-	TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition> TagsToCaptureDefs;
-
-	// 获取全局标签单例
+	// 1) 获取全局标签单例（伤害类型信息表）
 	const FAuraGamePlayTags& Tags = FAuraGamePlayTags::Get();
 
-	// 次级属性捕获定义
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_Armor,                DamageStatics().ArmorDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_ArmorPenetration,     DamageStatics().ArmorPenetrionDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_BlockChance,          DamageStatics().BlockChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitChance,    DamageStatics().CriticalHitChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitResistance,DamageStatics().CriticalHitResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitDamage,    DamageStatics().CriticalHitDamageDef);
-
-	// 元素/物理抗性捕获定义
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Fire,                DamageStatics().FireResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Lightning,           DamageStatics().LightningResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Arcane,              DamageStatics().ArcaneResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Physical,            DamageStatics().PhysicalResistanceDef);
-
 	// 2) 获取源与目标的 ASC
 	const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
 	const UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
@@ -255,29 +223,25 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	EvaluateParameters.SourceTags = SourceTags;
 	EvaluateParameters.TargetTags = TargetTags;
 
-	// 5) 先做 Debuff 判定（内部将使用 SetByCaller 与捕获值）
-	DetermineDebuff(ExecutionParams, Spec, EvaluateParameters, TagsToCaptureDefs);
-
-	// 6) 计算各伤害类型（按目标对应抗性衰减）并汇总
+	// 5) 按伤害类型索引遍历：Debuff 判定 + 按目标对应抗性衰减并汇总
 	float Damage = 0.f;
-	for (const TTuple<FGameplayTag, FGameplayTag>& Pair : FAuraGamePlayTags::Get().DamageTypesToResistance)
+	for (int32 DamageTypeIndex = 0; DamageTypeIndex < EAuraDamageTypeIndex::Num; ++DamageTypeIndex)
 	{
-		const FGameplayTag DamageTag = Pair.Key;    // 伤害类型标签
-		const FGameplayTag ResistanceTag = Pair.Value; // 对应抗性标签
-
-		// 映射完整性检查（开发期保障）
-		checkf(TagsToCaptureDefs.Contains(ResistanceTag),
-			TEXT("ExecCalc_Damage: TagsToCaptureDefs 不包含抗性标签 [%s]"), *ResistanceTag.ToString());
+		const FGameplayTag& DamageTag = Tags.DamageTypeInfos[DamageTypeIndex].DamageType; // 伤害类型标签
 
-		// 捕获定义（该抗性来自何处并如何求值）
-		const FGameplayEffectAttributeCaptureDefinition CaptureDef = TagsToCaptureDefs[ResistanceTag];
-
-		// 读取该类型伤害的 SetByCaller 值（未设置默认 0）
-		float DamageTypeValue = Spec.GetSetByCallerMagnitude(DamageTag, false);
+		// 读取该类型伤害的 SetByCaller 值（未设置时返回 -1，表示本次不含该类型）
+		float DamageTypeValue = Spec.GetSetByCallerMagnitude(DamageTag, false, -1.f);
+		if (DamageTypeValue <= -0.5f)
+		{
+			continue;
+		}
 
-		// 读取并求值目标的该类抗性
+		// 读取并求值目标的该类抗性（Debuff 判定与伤害衰减共用，只捕获一次）
 		float ResistanceValue = 0.f;
-		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(CaptureDef, EvaluateParameters, ResistanceValue);
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ResistanceDefs[DamageTypeIndex], EvaluateParameters, ResistanceValue);
+
+		// Debuff 判定（内部将使用 SetByCaller 与抗性值）
+		DetermineDebuff(Spec, DamageTypeIndex, ResistanceValue);
 
 		// 抗性范围限制到 [0, 100]
 		ResistanceValue = FMath::Clamp(ResistanceValue, 0.f, 100.f);
@@ -291,28 +255,15 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 
 		if (UAuraAbilitySystemLibrary::IsRadialDamage(EffectContextHandle))                 // 若这次效果被标记为“范围伤害”
 		{
-			// 如果目标实现了战斗接口：把“目标受伤时的委托”临时绑定一个 Lambda，用于回读伤害值
-			if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(TargetAvatar))   // 尝试把目标转成战斗接口
-			{
-				CombatInterface->GetOnDamageSignature().AddLambda([&](float DamageAmount)   // 临时绑定：收到伤害时，把金额写回外部变量
-				{
-					DamageTypeValue = DamageAmount;                                         // ⚠ 捕获的是**引用**，若异步触发可能悬空；且未解绑会重复叠加
-				});
-			}
-
-			// 执行“带衰减的范围伤害”
-			UGameplayStatics::ApplyRadialDamageWithFalloff(
-				TargetAvatar,                                                               // WorldContextObject（用来拿 World；Actor 也可以）
+			// 按目标到原点的距离解析计算衰减（与引擎衰减曲线一致；无物理查询、无委托绑定）
+			DamageTypeValue = UAuraAbilitySystemLibrary::GetRadialDamageWithFalloff(
 				DamageTypeValue,                                                            // 基准伤害（内半径处的伤害）
 				0.f,                                                                        // 最小伤害（外半径处），此处设为 0
 				UAuraAbilitySystemLibrary::GetRadialDamageOrigin(EffectContextHandle),      // 伤害原点
 				UAuraAbilitySystemLibrary::GetRadialDamageInnerRadius(EffectContextHandle), // 内半径（满伤）
 				UAuraAbilitySystemLibrary::GetRadialDamageOuterRadius(EffectContextHandle), // 外半径（最小伤害）
 				1.f,                                                                        // 衰减系数（越大衰减越快）
-				UDamageType::StaticClass(),                                                 // 伤害类型（引擎 DamageType，非 GameplayTag）
-				TArray<AActor*>(),                                                          // 忽略的 Actors（这里给了空数组）
-				SourceAvatar,                                                               // DamageCauser（谁造成伤害）
-				nullptr                                                                     // InstigatedByController（归属控制器，建议填！见建议）
+				TargetAvatar ? TargetAvatar->GetActorLocation() : FVector::ZeroVector       // 目标位置
 			);
 		}
 		
@@ -320,7 +271,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 		Damage += DamageTypeValue;
 	}
 
-	// 7) 格挡判定：按目标格挡几率减半伤害
+	// 6) 格挡判定：按目标格挡几率减半伤害
 	float TargetBlockChance = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().BlockChanceDef, EvaluateParameters, TargetBlockChance);
 	TargetBlockChance = FMath::Max(TargetBlockChance, 0.f);
@@ -334,7 +285,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	// 被格挡则伤害减半
 	Damage = bBlockChance ? Damage / 2.f : Damage;
 
-	// 8) 护甲与护甲穿透
+	// 7) 护甲与护甲穿透
 	float TargetArmor = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ArmorDef, EvaluateParameters, TargetArmor);
 	TargetArmor = FMath::Max(TargetArmor, 0.f);
@@ -343,21 +294,22 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ArmorPenetrionDef, EvaluateParameters, SourceArmorPenetration);
 	SourceArmorPenetration = FMath::Max(SourceArmorPenetration, 0.f);
 
-	// 读取曲线系数（护甲穿透/有效护甲）——按等级评估
+	// 读取曲线系数（护甲穿透/有效护甲）——按等级从烘焙缓存中直接下标读取
+	// 没有 Aura GameMode 的世界（如自动化测试）取不到职业信息，系数按 0 处理（护甲与暴击抗性不生效）
+	static const FDamageCalculationCoefficients EmptyCoefficients;
 	const UCharacterClassInfo* CharacterClassInfo = UAuraAbilitySystemLibrary::GetCharacterClassInfo(SourceAvatar);
-	const FRealCurve* ArmorPenetrationCurve = CharacterClassInfo->DamageCalculationCoefficientes->FindCurve(FName("ArmorPenetration"), FString());
-	const float ArmorPenetrationCoefficient = ArmorPenetrationCurve->Eval(SourcePlayerLevel);
+	const FDamageCalculationCoefficients& Coeffs = CharacterClassInfo ? CharacterClassInfo->GetDamageCalculationCoefficients() : EmptyCoefficients;
+	const float ArmorPenetrationCoefficient = Coeffs.ArmorPen[SourcePlayerLevel];
 
 	// 计算“有效护甲”（穿透降低护甲作用）
 	const float EffectiveArmorAfterPen = TargetArmor * (100.f - SourceArmorPenetration * ArmorPenetrationCoefficient) / 100.f;
 
-	const FRealCurve* EffectiveArmorCurve = CharacterClassInfo->DamageCalculationCoefficientes->FindCurve(FName("EffectiveArmor"), FString());
-	const float EffectiveArmorCoefficient = EffectiveArmorCurve->Eval(TargetPlayerLevel);
+	const float EffectiveArmorCoefficient = Coeffs.EffectiveArmor[TargetPlayerLevel];
 
 	// 按有效护甲系数衰减伤害
 	Damage *= (100.f - EffectiveArmorAfterPen * EffectiveArmorCoefficient) / 100.f;
 
-	// 9) 暴击计算：暴击率/暴击伤害/目标暴击抗性（含等级系数）
+	// 8) 暴击计算：暴击率/暴击伤害/目标暴击抗性（含等级系数）
 	float SourceCriticalHitChance = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CriticalHitChanceDef, EvaluateParameters, SourceCriticalHitChance);
 	SourceCriticalHitChance = FMath::Max(SourceCriticalHitChance, 0.f);
@@ -370,8 +322,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CriticalHitResistanceDef, EvaluateParameters, TargetCriticalHitResistance);
 	TargetCriticalHitResistance = FMath::Max(TargetCriticalHitResistance, 0.f);
 
-	const FRealCurve* CriticalHitResistanceCurve = CharacterClassInfo->DamageCalculationCoefficientes->FindCurve(FName("CriticalHitResistance"), FString());
-	const float CriticalHitResistanceCurveCoefficient = CriticalHitResistanceCurve->Eval(TargetPlayerLevel);
+	const float CriticalHitResistanceCurveCoefficient = Coeffs.CriticalHitResistance[TargetPlayerLevel];
 
 	// 有效暴击率 = 暴击率 - 目标抗性 * 等级系数
 	const float EffectiveCriticalHitChance = SourceCriticalHitChance - TargetCriticalHitResistance * CriticalHitResistanceCurveCoefficient;
@@ -383,7 +334,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	// 暴击伤害：2倍基础伤害 + 额外暴伤（可按项目规则调整）
 	Damage = bIsCriticalHit ? 2.f * Damage + SourceCriticalHitDamage : Damage;
 
-	// 10) 写入最终伤害到执行输出（对 IncomingDamage 做加法）
+	// 9) 写入最终伤害到执行输出（对 IncomingDamage 做加法）
 	const FGameplayModifierEvaluatedData EvaluatedData(
 		UAuraAttributeSet::GetIncomingDamageAttribute(), // 目标属性：IncomingDamage
 		EGameplayModOp::Additive,                        // 叠加方式：加法
@@ -0,0 +1,259 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraCombatantRegistry.h"
+
+#include "Algo/Sort.h"
+#include "Interation/CombatInterface.h"
+
+#include <algorithm>
+
+DECLARE_STATS_GROUP(TEXT("AuraCombatantRegistry"), STATGROUP_AuraCombatantRegistry, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Refresh Locations"), STAT_AuraCombatantRegistry_Refresh, STATGROUP_AuraCombatantRegistry);
+DECLARE_CYCLE_STAT(TEXT("Query"), STAT_AuraCombatantRegistry_Query, STATGROUP_AuraCombatantRegistry);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Combatants"), STAT_AuraCombatantRegistry_Num, STATGROUP_AuraCombatantRegistry);
+
+UAuraCombatantRegistry* UAuraCombatantRegistry::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UAuraCombatantRegistry>();
+	}
+	return nullptr;
+}
+
+/**
+ * @brief 只在游戏世界（含 PIE）中创建，编辑器预览等世界不需要
+ */
+bool UAuraCombatantRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraCombatantRegistry::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_AuraCombatantRegistry_Num, Combatants.Num());
+	Combatants.Empty();
+	ActorToIndex.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+/**
+ * @brief 注册存活单位
+ *
+ * @param Combatant 实现了 ICombatInterface 的 Actor（一般在 BeginPlay 中调用）
+ *
+ * 注意事项：
+ * - 碰撞半径取 GetSimpleCollisionRadius（角色即胶囊体半径），用于与旧的 Overlap 查询保持一致的边界判定。
+ */
+void UAuraCombatantRegistry::RegisterCombatant(AActor* Combatant)
+{
+	if (!IsValid(Combatant) || !Combatant->Implements<UCombatInterface>()) return;
+	if (ActorToIndex.Contains(Combatant)) return;
+
+	FCombatantEntry Entry;
+	Entry.Actor = Combatant;
+	Entry.ActorKey = Combatant;
+	Entry.Location = Combatant->GetActorLocation();
+	Entry.CollisionRadius = Combatant->GetSimpleCollisionRadius();
+	Entry.Cell = GetCellForLocation(Entry.Location);
+
+	const int32 EntryIndex = Combatants.Add(Entry);
+	ActorToIndex.Add(Combatant, EntryIndex);
+	Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+	MaxCollisionRadius = FMath::Max(MaxCollisionRadius, Entry.CollisionRadius);
+	INC_DWORD_STAT(STAT_AuraCombatantRegistry_Num);
+}
+
+void UAuraCombatantRegistry::UnregisterCombatant(AActor* Combatant)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!ActorToIndex.RemoveAndCopyValue(Combatant, EntryIndex)) return;
+
+	RemoveFromCell(EntryIndex, Combatants[EntryIndex].Cell);
+	Combatants.RemoveAt(EntryIndex);
+	DEC_DWORD_STAT(STAT_AuraCombatantRegistry_Num);
+}
+
+void UAuraCombatantRegistry::GetCombatantsInRadius(const FVector& Origin, float Radius, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraCombatantRegistry_Query);
+	ForEachCombatantInBounds(Origin, Radius, [&](const FCombatantEntry& Entry, AActor* Actor)
+	{
+		if (ActorsToIgnore.Contains(Actor)) return;
+		const float ReachRadius = Radius + Entry.CollisionRadius;
+		if (FVector::DistSquared(Entry.Location, Origin) <= FMath::Square(ReachRadius))
+		{
+			OutCombatants.Add(Actor);
+		}
+	});
+}
+
+/**
+ * @brief 最近 K 个单位
+ *
+ * 注意事项：
+ * - 与 AuraClosestTargets::Select 相同：候选多于 K 个时先用 nth_element 把最近的 K 个划分到前面，再只对这 K 个排序（平均 O(N + K log K)）；
+ * - 距离相同时按收集顺序排列，结果稳定可复现。
+ */
+void UAuraCombatantRegistry::GetClosestCombatants(const FVector& Origin, int32 MaxCount, float MaxRadius, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore)
+{
+	if (MaxCount <= 0) return;
+	SCOPE_CYCLE_COUNTER(STAT_AuraCombatantRegistry_Query);
+
+	// 收集候选（距离平方与 Actor 分开存放），候选下标用于划分与排序
+	TArray<double, TInlineAllocator<32>> DistancesSquared;
+	TArray<AActor*, TInlineAllocator<32>> CandidateActors;
+	ForEachCombatantInBounds(Origin, MaxRadius, [&](const FCombatantEntry& Entry, AActor* Actor)
+	{
+		if (ActorsToIgnore.Contains(Actor)) return;
+		const double DistanceSquared = FVector::DistSquared(Entry.Location, Origin);
+		if (DistanceSquared <= FMath::Square(MaxRadius + Entry.CollisionRadius))
+		{
+			DistancesSquared.Add(DistanceSquared);
+			CandidateActors.Add(Actor);
+		}
+	});
+
+	TArray<int32, TInlineAllocator<32>> Candidates;
+	Candidates.SetNumUninitialized(CandidateActors.Num());
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		Candidates[Index] = Index;
+	}
+
+	const auto IsCloser = [&DistancesSquared](int32 A, int32 B)
+	{
+		return DistancesSquared[A] < DistancesSquared[B] || (DistancesSquared[A] == DistancesSquared[B] && A < B);
+	};
+
+	const int32 NumResults = FMath::Min(MaxCount, Candidates.Num());
+	if (NumResults < Candidates.Num())
+	{
+		std::nth_element(Candidates.GetData(), Candidates.GetData() + NumResults, Candidates.GetData() + Candidates.Num(), IsCloser);
+	}
+	Algo::Sort(MakeArrayView(Candidates.GetData(), NumResults), IsCloser);
+
+	OutCombatants.Reserve(OutCombatants.Num() + NumResults);
+	for (int32 Rank = 0; Rank < NumResults; ++Rank)
+	{
+		OutCombatants.Add(CandidateActors[Candidates[Rank]]);
+	}
+}
+
+void UAuraCombatantRegistry::GetCombatantsInCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Range, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraCombatantRegistry_Query);
+	const FVector ConeDirection = Direction.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.f, 180.f)));
+
+	ForEachCombatantInBounds(Origin, Range, [&](const FCombatantEntry& Entry, AActor* Actor)
+	{
+		if (ActorsToIgnore.Contains(Actor)) return;
+		const FVector ToTarget = Entry.Location - Origin;
+		const double DistanceSquared = ToTarget.SizeSquared();
+		if (DistanceSquared > FMath::Square(Range + Entry.CollisionRadius)) return;
+		// 与顶点重合视为在锥内
+		if (DistanceSquared <= UE_KINDA_SMALL_NUMBER || FVector::DotProduct(ToTarget / FMath::Sqrt(DistanceSquared), ConeDirection) >= CosHalfAngle)
+		{
+			OutCombatants.Add(Actor);
+		}
+	});
+}
+
+FIntPoint UAuraCombatantRegistry::GetCellForLocation(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UAuraCombatantRegistry::RefreshIfStale()
+{
+	if (LastRefreshFrame == GFrameCounter) return;
+	LastRefreshFrame = GFrameCounter;
+	RefreshLocations();
+}
+
+/**
+ * @brief 刷新所有单位的位置；跨格的单位从旧格子搬到新格子；已被销毁的单位按下标与键直接移除
+ */
+void UAuraCombatantRegistry::RefreshLocations()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraCombatantRegistry_Refresh);
+	TArray<int32, TInlineAllocator<8>> StaleEntries;
+	for (auto It = Combatants.CreateIterator(); It; ++It)
+	{
+		FCombatantEntry& Entry = *It;
+		const AActor* Actor = Entry.Actor.Get();
+		if (Actor == nullptr)
+		{
+			StaleEntries.Add(It.GetIndex());
+			continue;
+		}
+
+		Entry.Location = Actor->GetActorLocation();
+		const FIntPoint NewCell = GetCellForLocation(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(It.GetIndex(), Entry.Cell);
+			Cells.FindOrAdd(NewCell).Add(It.GetIndex());
+			Entry.Cell = NewCell;
+		}
+	}
+
+	for (const int32 EntryIndex : StaleEntries)
+	{
+		const FCombatantEntry& Entry = Combatants[EntryIndex];
+		RemoveFromCell(EntryIndex, Entry.Cell);
+		// 条目保存了注册时的键，Actor 销毁后仍可直接按键移除，无需扫描整张映射
+		ActorToIndex.Remove(Entry.ActorKey);
+		Combatants.RemoveAt(EntryIndex);
+		DEC_DWORD_STAT(STAT_AuraCombatantRegistry_Num);
+	}
+}
+
+void UAuraCombatantRegistry::RemoveFromCell(int32 EntryIndex, const FIntPoint& Cell)
+{
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (CellEntries->IsEmpty())
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+/**
+ * @brief 遍历与以 Origin 为中心、(Radius + 最大碰撞半径) 为半边长的方形相交的格子中的全部单位
+ *
+ * 注意事项：
+ * - 只做格子级的粗筛，精确的距离/角度判定由调用方完成；
+ * - 回调参数为（单位条目, 有效的 Actor），失效的弱引用会被跳过。
+ */
+template<typename FunctorType>
+void UAuraCombatantRegistry::ForEachCombatantInBounds(const FVector& Origin, float Radius, FunctorType&& Functor)
+{
+	RefreshIfStale();
+
+	const float Reach = FMath::Max(Radius, 0.f) + MaxCollisionRadius;
+	const FIntPoint MinCell = GetCellForLocation(Origin - FVector(Reach, Reach, 0.f));
+	const FIntPoint MaxCell = GetCellForLocation(Origin + FVector(Reach, Reach, 0.f));
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+			if (CellEntries == nullptr) continue;
+
+			for (const int32 EntryIndex : *CellEntries)
+			{
+				const FCombatantEntry& Entry = Combatants[EntryIndex];
+				if (AActor* Actor = Entry.Actor.Get())
+				{
+					Functor(Entry, Actor);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraEnemyPool.h"
+
+#include "Character/EnemyCharacter.h"
+
+DECLARE_STATS_GROUP(TEXT("AuraEnemyPool"), STATGROUP_AuraEnemyPool, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reused Enemies"), STAT_AuraEnemyPool_Reused, STATGROUP_AuraEnemyPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawned Enemies"), STAT_AuraEnemyPool_Spawned, STATGROUP_AuraEnemyPool);
+
+UAuraEnemyPool* UAuraEnemyPool::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UAuraEnemyPool>();
+	}
+	return nullptr;
+}
+
+bool UAuraEnemyPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraEnemyPool::Deinitialize()
+{
+	Buckets.Empty();
+	Super::Deinitialize();
+}
+
+/**
+ * @brief 取出一个可用的敌人（空闲实例优先，否则延迟生成新实例）
+ *
+ * @param EnemyClass     敌人类
+ * @param SpawnTransform 生成变换
+ * @param Level          敌人等级（用于初始化默认属性）
+ * @param CharacterClass 敌人职业（决定默认属性与初始技能）
+ * @return 已激活且已被 AI 控制器 Possess 的敌人；生成失败时返回 nullptr
+ *
+ * 详细流程：
+ * 1) 从对应类的空闲列表弹出实例，跳过已被外部销毁的；命中则 ActivateFromPool 重新初始化；
+ * 2) 否则按原生成点的方式 SpawnActorDeferred → 写入等级/职业 → FinishSpawning → SpawnDefaultController，
+ *    并标记为池管理实例，使其死亡后回到池中。
+ */
+AEnemyCharacter* UAuraEnemyPool::AcquireEnemy(TSubclassOf<AEnemyCharacter> EnemyClass, const FTransform& SpawnTransform, int32 Level, ECharacterClass CharacterClass)
+{
+	if (EnemyClass == nullptr) return nullptr;
+
+	if (FAuraEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass.Get()))
+	{
+		while (!Bucket->FreeEnemies.IsEmpty())
+		{
+			AEnemyCharacter* Enemy = Bucket->FreeEnemies.Pop(EAllowShrinking::No);
+			// 被外部销毁的实例直接丢弃
+			if (!IsValid(Enemy)) continue;
+
+			Enemy->ActivateFromPool(SpawnTransform, Level, CharacterClass);
+			INC_DWORD_STAT(STAT_AuraEnemyPool_Reused);
+			return Enemy;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (World == nullptr) return nullptr;
+
+	AEnemyCharacter* Enemy = World->SpawnActorDeferred<AEnemyCharacter>(
+		EnemyClass,
+		SpawnTransform,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (Enemy == nullptr) return nullptr;
+
+	Enemy->SetLevel(Level);
+	Enemy->SetCharacterClass(CharacterClass);
+	Enemy->InitPooled();
+	Enemy->FinishSpawning(SpawnTransform);
+	Enemy->SpawnDefaultController();
+	INC_DWORD_STAT(STAT_AuraEnemyPool_Spawned);
+	return Enemy;
+}
+
+/**
+ * @brief 停用敌人并放回对应类的空闲列表；空闲列表已满时直接销毁
+ */
+void UAuraEnemyPool::ReleaseEnemy(AEnemyCharacter* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	FAuraEnemyPoolBucket& Bucket = Buckets.FindOrAdd(Enemy->GetClass());
+	if (Bucket.FreeEnemies.Num() >= MaxPooledPerClass)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	Bucket.FreeEnemies.Add(Enemy);
+}
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraEnemySpawnScheduler.h"
+
+#include "Actor/AuraEnemySpawnPoint.h"
+
+DECLARE_STATS_GROUP(TEXT("AuraEnemySpawn"), STATGROUP_AuraEnemySpawn, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Spawn Enemy"), STAT_AuraEnemySpawn_SpawnEnemy, STATGROUP_AuraEnemySpawn);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queue Depth"), STAT_AuraEnemySpawn_QueueDepth, STATGROUP_AuraEnemySpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns Per Frame"), STAT_AuraEnemySpawn_SpawnsPerFrame, STATGROUP_AuraEnemySpawn);
+
+UAuraEnemySpawnScheduler* UAuraEnemySpawnScheduler::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UAuraEnemySpawnScheduler>();
+	}
+	return nullptr;
+}
+
+bool UAuraEnemySpawnScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraEnemySpawnScheduler::Deinitialize()
+{
+	PendingSpawns.Empty();
+	SET_DWORD_STAT(STAT_AuraEnemySpawn_QueueDepth, 0);
+	Super::Deinitialize();
+}
+
+TStatId UAuraEnemySpawnScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraEnemySpawnScheduler, STATGROUP_Tickables);
+}
+
+bool UAuraEnemySpawnScheduler::IsHigherPriority(const FPendingEnemySpawn& A, const FPendingEnemySpawn& B)
+{
+	return A.DistanceSquared < B.DistanceSquared || (A.DistanceSquared == B.DistanceSquared && A.Sequence < B.Sequence);
+}
+
+void UAuraEnemySpawnScheduler::QueueSpawn(AAuraEnemySpawnPoint* SpawnPoint, const FVector& PriorityOrigin)
+{
+	if (!IsValid(SpawnPoint)) return;
+
+	FPendingEnemySpawn PendingSpawn;
+	PendingSpawn.SpawnPoint = SpawnPoint;
+	PendingSpawn.DistanceSquared = FVector::DistSquared(SpawnPoint->GetActorLocation(), PriorityOrigin);
+	PendingSpawn.Sequence = NextSequence++;
+	PendingSpawns.HeapPush(PendingSpawn, &UAuraEnemySpawnScheduler::IsHigherPriority);
+	SET_DWORD_STAT(STAT_AuraEnemySpawn_QueueDepth, PendingSpawns.Num());
+}
+
+/**
+ * @brief 在本帧预算内依次处理生成请求
+ *
+ * 详细流程：
+ * 1. 从堆顶取出离触发玩家最近的请求，生成点已失效则跳过；
+ * 2. 调用 SpawnEnemy（延迟生成 + FinishSpawning + SpawnDefaultController）；
+ * 3. 累计耗时超过 SpawnBudgetMilliseconds 后停止，剩余请求留到下一帧。
+ */
+void UAuraEnemySpawnScheduler::Tick(float DeltaTime)
+{
+	const double BudgetSeconds = FMath::Max(SpawnBudgetMilliseconds, 0.f) * 0.001;
+	const double StartTime = FPlatformTime::Seconds();
+
+	while (!PendingSpawns.IsEmpty())
+	{
+		FPendingEnemySpawn PendingSpawn;
+		PendingSpawns.HeapPop(PendingSpawn, &UAuraEnemySpawnScheduler::IsHigherPriority, EAllowShrinking::No);
+
+		if (AAuraEnemySpawnPoint* SpawnPoint = PendingSpawn.SpawnPoint.Get())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_AuraEnemySpawn_SpawnEnemy);
+			SpawnPoint->SpawnEnemy();
+			INC_DWORD_STAT(STAT_AuraEnemySpawn_SpawnsPerFrame);
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds) break;
+	}
+
+	SET_DWORD_STAT(STAT_AuraEnemySpawn_QueueDepth, PendingSpawns.Num());
+}
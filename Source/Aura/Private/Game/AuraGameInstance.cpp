@@ -3,3 +3,165 @@
 
 #include "Game/AuraGameInstance.h"
 
+#include "Aura/AuraLogChannels.h"
+#include "Game/AuraSaveGameFormat.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "Kismet/GameplayStatics.h"
+
+/**
+ * @brief 获取当前槽位的会话存档
+ *
+ * @param SaveGameClass 槽位不存在存档文件时用于创建新存档的类（GameMode 上配置的 LoadScreenSaveGameClass）
+ * @return 会话存档；创建失败时返回 nullptr
+ *
+ * 功能说明：
+ * - 检查点、地图入口、角色进度的保存与读取都通过这个对象完成，不再每次从磁盘重新读取；
+ * - 槽位切换时，先等待进行中的后台写盘完成；若旧槽位还有未提交的修改，同步写入旧槽位后再读取新槽位。
+ */
+ULoadScreenSaveGame* UAuraGameInstance::GetSessionSaveGame(TSubclassOf<USaveGame> SaveGameClass)
+{
+	if (IsValid(SessionSaveGame) && SessionSlotName == LoadSlotName && SessionSlotIndex == LoadSlotIndex)
+	{
+		return SessionSaveGame;
+	}
+
+	// 读取槽位前保证没有进行中的写入（新槽位可能正是刚被重置的同一槽位）
+	WaitForSessionSave();
+	if (IsValid(SessionSaveGame) && bSessionSaveRequested)
+	{
+		bSessionSaveRequested = false;
+		FAuraSaveGameFormat::SaveToSlot(SessionSaveGame, SessionSlotName, SessionSlotIndex);
+	}
+
+	USaveGame* SaveGameObject = nullptr;
+	if (UGameplayStatics::DoesSaveGameExist(LoadSlotName, LoadSlotIndex))
+	{
+		SaveGameObject = FAuraSaveGameFormat::LoadFromSlot(LoadSlotName, LoadSlotIndex);
+	}
+	else if (SaveGameClass)
+	{
+		SaveGameObject = UGameplayStatics::CreateSaveGameObject(SaveGameClass);
+	}
+
+	SessionSaveGame = Cast<ULoadScreenSaveGame>(SaveGameObject);
+	SessionSlotName = LoadSlotName;
+	SessionSlotIndex = LoadSlotIndex;
+	return SessionSaveGame;
+}
+
+/**
+ * @brief 请求提交会话存档
+ *
+ * 注意事项：
+ * - 检查点触发时 SaveWorldState 与 SaveProgress 在同一帧先后调用，这里只做标记，
+ *   下一帧统一提交，两次修改合并为一次写盘；
+ * - 使用引擎核心 Ticker 而不是世界定时器，地图入口保存后立即切换关卡也不会丢失这次提交。
+ */
+void UAuraGameInstance::RequestSessionSave()
+{
+	if (!IsValid(SessionSaveGame)) return;
+
+	bSessionSaveRequested = true;
+	if (!SessionSaveTickerHandle.IsValid())
+	{
+		SessionSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UAuraGameInstance::TickSessionSave));
+	}
+}
+
+void UAuraGameInstance::ResetSessionSaveGame()
+{
+	// 调用方随后会直接读写该槽位，不能与后台写盘并发
+	WaitForSessionSave();
+	SessionSaveGame = nullptr;
+	SessionSlotName.Reset();
+	SessionSlotIndex = INDEX_NONE;
+	bSessionSaveRequested = false;
+}
+
+bool UAuraGameInstance::TickSessionSave(float DeltaTime)
+{
+	SessionSaveTickerHandle.Reset();
+	// 上一次写盘尚未完成时等待其回调再提交
+	if (bSessionSaveRequested && !bSessionSaveInFlight)
+	{
+		CommitSessionSave();
+	}
+	return false;
+}
+
+/**
+ * @brief 异步提交会话存档
+ *
+ * 详细流程：
+ * 1) FAuraSaveGameFormat::AsyncSaveToSlot 在游戏线程把存档对象序列化到内存（必须在游戏线程读取 UObject）；
+ * 2) 压缩与写文件在后台线程完成，完成后回到游戏线程调用 OnSessionSaveFinished（GameInstance 已销毁时忽略）。
+ */
+void UAuraGameInstance::CommitSessionSave()
+{
+	bSessionSaveRequested = false;
+	bSessionSaveInFlight = true;
+	const uint32 Serial = ++SessionSaveSerial;
+	TWeakObjectPtr<UAuraGameInstance> WeakThis(this);
+	SessionSaveTask = FAuraSaveGameFormat::AsyncSaveToSlot(SessionSaveGame, SessionSlotName, SessionSlotIndex,
+		[WeakThis, SlotName = SessionSlotName, SlotIndex = SessionSlotIndex, Serial](bool bSuccess)
+		{
+			if (UAuraGameInstance* GameInstance = WeakThis.Get())
+			{
+				GameInstance->OnSessionSaveFinished(SlotName, SlotIndex, bSuccess, Serial);
+			}
+		});
+}
+
+void UAuraGameInstance::OnSessionSaveFinished(const FString& SlotName, const int32 UserIndex, bool bSuccess, uint32 Serial)
+{
+	if (!bSuccess)
+	{
+		UE_LOG(LogAura, Error, TEXT("Failed to write save slot %s (%d)"), *SlotName, UserIndex);
+	}
+	// 之后又有新的提交：状态归属于新的提交，这里不再处理
+	if (Serial != SessionSaveSerial) return;
+
+	bSessionSaveInFlight = false;
+	SessionSaveTask.SafeRelease();
+	// 写盘期间又有新的修改：立即提交下一次
+	if (bSessionSaveRequested && IsValid(SessionSaveGame))
+	{
+		CommitSessionSave();
+	}
+}
+
+void UAuraGameInstance::Shutdown()
+{
+	if (SessionSaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SessionSaveTickerHandle);
+		SessionSaveTickerHandle.Reset();
+	}
+	// 等待进行中的后台写盘，避免与下面的同步写入交错写同一个文件
+	WaitForSessionSave();
+	// 退出时仍有未提交的修改：同步写入，保证不丢档
+	if (bSessionSaveRequested && IsValid(SessionSaveGame))
+	{
+		bSessionSaveRequested = false;
+		FAuraSaveGameFormat::SaveToSlot(SessionSaveGame, SessionSlotName, SessionSlotIndex);
+	}
+	Super::Shutdown();
+}
+
+/**
+ * @brief 等待进行中的后台写盘完成
+ *
+ * 注意事项：
+ * - 任务只负责压缩与写文件，完成回调另行投递到游戏线程，因此在游戏线程上阻塞等待不会死锁；
+ * - 迟到的完成回调仍会到达，序号相同时只做收尾（记录失败、提交等待中的修改）。
+ */
+void UAuraGameInstance::WaitForSessionSave()
+{
+	if (SessionSaveTask.IsValid() && !SessionSaveTask->IsComplete())
+	{
+		SessionSaveTask->Wait();
+	}
+	SessionSaveTask.SafeRelease();
+	bSessionSaveInFlight = false;
+}
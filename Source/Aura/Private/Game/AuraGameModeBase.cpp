@@ -3,10 +3,11 @@
 
 #include "Game/AuraGameModeBase.h"
 
-#include "EngineUtils.h"
 #include "Aura/AuraLogChannels.h"
 #include "Game/AuraGameInstance.h"
+#include "Game/AuraSaveGameFormat.h"
 #include "Game/LoadScreenSaveGame.h"
+#include "Game/AuraSaveableActorRegistry.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerStart.h"
 #include "Interation/SaveInterface.h"
@@ -14,6 +15,13 @@
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "UI/ViewModel/MVVM_LoadSlot.h"
 
+DECLARE_STATS_GROUP(TEXT("AuraSave"), STATGROUP_AuraSave, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("SaveWorldState"), STAT_AuraSave_SaveWorldState, STATGROUP_AuraSave);
+DECLARE_CYCLE_STAT(TEXT("LoadWorldState"), STAT_AuraSave_LoadWorldState, STATGROUP_AuraSave);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Visited"), STAT_AuraSave_ActorsVisited, STATGROUP_AuraSave);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Saved"), STAT_AuraSave_ActorsSaved, STATGROUP_AuraSave);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Loaded"), STAT_AuraSave_ActorsLoaded, STATGROUP_AuraSave);
+
 /**
  * @brief 将一个 ViewModel 中的数据保存到磁盘上的一个存档槽位。
  * @param LoadSlot 包含需要保存数据的 ViewModel 指针。
@@ -28,10 +36,15 @@
  * 2.  **创建存档实例**: 调用 `CreateSaveGameObject` 在内存中创建一个新的存档对象实例。`LoadScreenSaveGameClass` 是一个蓝图中指定的 `TSubclassOf<USaveGame>`。
  * 3.  **类型转换**: 将通用的 `USaveGame` 指针安全地转换为具体的 `ULoadScreenSaveGame` 指针，以便访问其自定义的成员变量。
  * 4.  **数据拷贝**: 从 `LoadSlot` ViewModel 中获取玩家名和地图名，并赋值给 `LoadScreenSaveGame` 对象的相应变量。同时，将存档状态硬编码为 `Taken`。
- * 5.  **写入磁盘**: 调用 `SaveGameToSlot`，将填充好数据的存档对象序列化到磁盘文件中。
+ * 5.  **写入磁盘**: 调用 `FAuraSaveGameFormat::SaveToSlot`，将填充好数据的存档对象以压缩的二进制格式写入磁盘文件中。
  */
 void AAuraGameModeBase::SaveSlotData(UMVVM_LoadSlot* LoadSlot, int32 SlotIndex)
 {
+	// 槽位文件将被重建，内存中缓存的会话存档失效；重置时会等待进行中的后台写盘，避免与下面的删除/写入并发。
+	if (UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance()))
+	{
+		AuraGameInstance->ResetSessionSaveGame();
+	}
 	// (为什么这么做): 这是一个“覆盖保存”的逻辑。先检查存档是否存在，如果存在就删除。
 	// 这样可以确保每次保存都是一个全新的、干净的数据文件，避免了处理旧数据合并的复杂性。
 	if (UGameplayStatics::DoesSaveGameExist(LoadSlot->GetLoadSlotName(), SlotIndex))
@@ -48,8 +61,8 @@ void AAuraGameModeBase::SaveSlotData(UMVVM_LoadSlot* LoadSlot, int32 SlotIndex)
 	LoadScreenSaveGame->SaveSlotStatus = Taken; // 将存档状态标记为“已占用”。
 	LoadScreenSaveGame->PlayerStartTag = LoadSlot->PlayerStartTag;
 	LoadScreenSaveGame->MapAssetName = LoadSlot->MapAssetName;
-	// 调用引擎的静态函数，将内存中的存档对象写入到磁盘。文件名由 SlotName 和 SlotIndex 共同决定。
-	UGameplayStatics::SaveGameToSlot(LoadScreenSaveGame, LoadSlot->GetLoadSlotName(), SlotIndex);
+	// 将内存中的存档对象以项目的存档格式写入到磁盘。文件名由 SlotName 和 SlotIndex 共同决定。
+	FAuraSaveGameFormat::SaveToSlot(LoadScreenSaveGame, LoadSlot->GetLoadSlotName(), SlotIndex);
 }
 
 /**
@@ -71,8 +84,8 @@ ULoadScreenSaveGame* AAuraGameModeBase::GetSaveSlotData(const FString& SlotName,
 	// 检查磁盘上是否存在对应的存档文件。
 	if (UGameplayStatics::DoesSaveGameExist(SlotName, SlotIndex))
 	{
-		// 如果存在，则从磁盘加载，并将其内容反序列化到 SaveGameObject 中。
-		SaveGameObject = UGameplayStatics::LoadGameFromSlot(SlotName, SlotIndex);
+		// 如果存在，则从磁盘加载，并将其内容反序列化到 SaveGameObject 中（旧格式存档同样可以读取）。
+		SaveGameObject = FAuraSaveGameFormat::LoadFromSlot(SlotName, SlotIndex);
 	}
 	else
 	{
@@ -92,6 +105,11 @@ ULoadScreenSaveGame* AAuraGameModeBase::GetSaveSlotData(const FString& SlotName,
  */
 void AAuraGameModeBase::DeleteSlot(const FString& SlotName, int32 SlotIndex)
 {
+	// 与 SaveSlotData 相同：先丢弃会话存档并等待进行中的后台写盘，避免删除后又被写回。
+	if (UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance()))
+	{
+		AuraGameInstance->ResetSessionSaveGame();
+	}
 	// 在尝试删除前，先检查文件是否存在，这是一个好习惯，可以避免不必要的磁盘操作或潜在的警告。
 	if (UGameplayStatics::DoesSaveGameExist(SlotName, SlotIndex))
 	{
@@ -104,20 +122,17 @@ void AAuraGameModeBase::DeleteSlot(const FString& SlotName, int32 SlotIndex)
  * @return 指向已加载或新创建的 ULoadScreenSaveGame 对象的指针。
  *
  * @par 功能说明
- * 这是一个辅助函数，用于统一获取“当前游戏内”正在使用的存档对象。它首先从 GameInstance 读取
- * 玩家在主菜单选择的存档槽位名称和索引，然后调用另一个辅助函数 `GetSaveSlotData` 来执行
- * 实际的加载或创建操作。
+ * 这是一个辅助函数，用于统一获取“当前游戏内”正在使用的存档对象。存档对象由 GameInstance 作为
+ * 会话存档持有：整个会话只从磁盘读取一次，之后的读取和修改都作用在同一个内存对象上。
  */
-ULoadScreenSaveGame* AAuraGameModeBase::RetrieveInGameSaveData()
+ULoadScreenSaveGame* AAuraGameModeBase::RetrieveInGameSaveData() const
 {
 	// (为什么这么做): GameInstance 是一个在切换关卡时依然存在的对象。
-	// 将玩家选择的存档槽信息（LoadSlotName, LoadSlotIndex）存在这里，是跨关卡传递数据的最佳实践。
+	// 玩家选择的存档槽信息（LoadSlotName, LoadSlotIndex）以及会话存档都存在这里，跨关卡保持不变。
 	UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance());
-	const FString InGameLoadSlotName = AuraGameInstance->LoadSlotName; // 从 GameInstance 读取存档名。
-	const int32 InGameLoadSlotIndex = AuraGameInstance->LoadSlotIndex; // 从 GameInstance 读取存档索引。
-	
-	// 调用我们之前分析过的函数，它会从磁盘加载或在内存中创建一个新的存档对象。
-	return GetSaveSlotData(InGameLoadSlotName, InGameLoadSlotIndex);
+	if (AuraGameInstance == nullptr) return nullptr;
+
+	return AuraGameInstance->GetSessionSaveGame(LoadScreenSaveGameClass);
 }
 
 
@@ -127,17 +142,18 @@ ULoadScreenSaveGame* AAuraGameModeBase::RetrieveInGameSaveData()
  *
  * @par 功能说明
  * 这个函数负责将高层级的游戏进度（例如玩家下一次应该出现的出生点 Tag）提交到 GameInstance，
- * 并将传入的整个 `SaveObject` 序列化到磁盘。
+ * 并请求提交会话存档。
+ *
+ * @par 注意事项
+ * - `SaveObject` 应当是 `RetrieveInGameSaveData` 返回的会话存档；写盘与同一帧内的 `SaveWorldState` 合并，
+ *   下一帧在后台线程完成，而不是在这里同步写入。
  */
 void AAuraGameModeBase::SaveInGameProgressData(ULoadScreenSaveGame* SaveObject)
 {
 	UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance());
-	const FString InGameLoadSlotName = AuraGameInstance->LoadSlotName;// 同样，从 GameInstance 获取存档槽信息。
-	const int32 InGameLoadSlotIndex = AuraGameInstance->LoadSlotIndex;
 	// 将存档对象中的 PlayerStartTag 更新到 GameInstance 中，这可能是为了关卡切换后能立即使用。
 	AuraGameInstance->PlayerStartTag = SaveObject->PlayerStartTag;
-	// 将传入的 SaveObject 完整地写入磁盘。
-	UGameplayStatics::SaveGameToSlot(SaveObject,InGameLoadSlotName,InGameLoadSlotIndex);
+	AuraGameInstance->RequestSessionSave();
 }
 
 
@@ -153,26 +169,31 @@ void AAuraGameModeBase::SaveInGameProgressData(ULoadScreenSaveGame* SaveObject)
  * 
  * @par 详细流程
  * 1.  获取并清理当前地图的名称。
- * 2.  加载当前游戏的存档对象。
- * 3.  检查存档中是否已有本地图的记录，如果没有则创建一条新记录。
- * 4.  清空本地图之前保存的所有 Actor 数据，准备进行一次全新的“快照”保存。
- * 5.  使用 `FActorIterator` 遍历世界中的所有 Actor。
- * 6.  对每个 Actor，检查它是否实现了 `USaveInterface` 接口。
- * 7.  如果实现了，就将其 Transform (位置、旋转、缩放) 和通过 `Serialize` 函数导出的自定义数据打包到一个 `FSavedActor` 结构体中。
- * 8.  将这个结构体添加到地图的 Actor 记录中。
- * 9.  遍历结束后，将更新后的存档对象写回磁盘。
+ * 2.  获取当前会话存档（内存中的对象，不再从磁盘读取）。
+ * 3.  通过按名称建立的索引取得本地图的记录（没有则创建），以引用方式修改。
+ * 4.  保留本地图之前保存的 Actor 数据（增量保存）。
+ * 5.  遍历可保存 Actor 注册表（UAuraSaveableActorRegistry）中登记的 Actor，而不是扫描整个世界。
+ * 6.  跳过已失效的 Actor。
+ * 7.  按 Actor 名称取得地图中的 `FSavedActor` 记录，写入其 Transform (位置、旋转、缩放)；仅当 Actor 被标记为脏
+ *     （`ISaveInterface::MarkSaveDirty`）或存档中还没有其记录时，才通过 `Serialize` 重新导出自定义数据。
+ * 8.  遍历结束后，请求提交会话存档（与同一帧内的玩家进度保存合并，下一帧在后台线程写盘）。
  */
 void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& DestinationMapAssetName) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_AuraSave_SaveWorldState);
+
 	// 步骤 1/5: 准备工作
 	FString WorldName = World->GetMapName();// 获取关卡资源名，例如 "UEDPIE_0_L_TestMap"。
 	WorldName.RemoveFromStart(World->StreamingLevelsPrefix);// 清理掉编辑器运行时的前缀，得到干净的地图名 "L_TestMap"。
 
+	UAuraSaveableActorRegistry* SaveableActorRegistry = UAuraSaveableActorRegistry::Get(World);
+	if (SaveableActorRegistry == nullptr) return;
+
 	UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(GetGameInstance());
 	check(AuraGI);// check() 是一个断言，如果 AuraGI 为空，程序会在开发版本中崩溃并报错。这用于强制要求 GameInstance 必须有效。
 
-	// 使用之前的辅助函数获取当前存档对象。
-	if (ULoadScreenSaveGame* SaveGame = GetSaveSlotData(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex))
+	// 获取会话存档对象。
+	if (ULoadScreenSaveGame* SaveGame = AuraGI->GetSessionSaveGame(LoadScreenSaveGameClass))
 	{
 		//如果目标地图资产名称不等于空
 		if (DestinationMapAssetName != FString(""))
@@ -181,27 +202,29 @@ void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& Destination
 			SaveGame->MapAssetName = DestinationMapAssetName;
 			SaveGame->MapName = GetMapNameFromMapAssetName(DestinationMapAssetName);
 		}
-		// 步骤 2/5: 确保地图记录存在
-		if (!SaveGame->HasMap(WorldName)) // 检查存档里是否已经有这个地图的数据了。
+		// 步骤 2/5: 获取（或创建）本地图的存档记录，直接在存档对象内修改，不再拷贝整个地图。
+		FSavedMap& SavedMap = SaveGame->FindOrAddSavedMap(WorldName);
+		// 步骤 3/5: 遍历可保存的 Actor，只重新序列化被标记为脏（或尚无记录）的 Actor
+		// (为什么这么做): 不再清空上次保存的数据。未修改的 Actor 沿用存档中的字节数据，
+		// 保存耗时只与本次变化的 Actor 数量有关；已被销毁的 Actor（例如已触发的刷怪区域）的记录也会保留下来。
+
+		// 只遍历注册表中的可保存 Actor（注册时已确认实现了 USaveInterface）。
+		for (const TWeakObjectPtr<AActor>& SaveableActor : SaveableActorRegistry->GetSaveableActors())
 		{
-			FSavedMap NewSaveMap;// 如果没有，创建一个新的地图存档结构。
-			NewSaveMap.MapAssetName = WorldName;
-			SaveGame->SavedMaps.Add(NewSaveMap); // 添加到存档对象的地图列表中。
-		}
-		// 步骤 3/5: 遍历并序列化所有可保存的 Actor
-		FSavedMap SavedMap = SaveGame->GetSavedMapWithMapName(WorldName); // 获取本地图的存档数据结构。
-		SavedMap.SavedActors.Empty(); // 清空上次保存的 Actor 数据，本次保存将完全覆盖。
+			INC_DWORD_STAT(STAT_AuraSave_ActorsVisited);
+			AActor* Actor = SaveableActor.Get();
+			// 过滤器：跳过正在销毁的 Actor。
+			if (!IsValid(Actor)) continue;
 
-		for (FActorIterator It(World); It; ++It)// FActorIterator 是遍历关卡中所有 Actor 的标准工具。
-		{
-			AActor* Actor = *It;
-			// 过滤器：Actor 必须有效，并且必须实现了 USaveInterface 接口，否则就跳过。
-			if (!IsValid(Actor) || !Actor->Implements<USaveInterface>()) continue;
-
-			FSavedActor SavedActor;// 创建一个用于存储单个 Actor 数据的结构体。
-			SavedActor.ActorName = Actor->GetFName();// 保存 Actor 的唯一名称 (FName)。
-			SavedActor.Transform = Actor->GetTransform();// 保存 Actor 的 Transform。
+			// 按 Actor 的唯一名称 (FName) 取得记录（名称相同的 Actor 只保留一条，与原先的 AddUnique 一致）。
+			const bool bHasRecord = SavedMap.FindSavedActor(Actor->GetFName()) != nullptr;
+			FSavedActor& SavedActor = SavedMap.FindOrAddSavedActor(Actor->GetFName());
+			SavedActor.Transform = Actor->GetTransform();// 保存 Actor 的 Transform（开销很小，总是刷新）。
+			if (bHasRecord && !SaveableActorRegistry->IsSaveableActorDirty(Actor)) continue;
 
+			INC_DWORD_STAT(STAT_AuraSave_ActorsSaved);
+			SaveableActorRegistry->ClearSaveableActorDirty(Actor);
+			SavedActor.Bytes.Reset();
 
 			// (为什么这么做): 这是 Unreal Engine 底层的对象序列化机制。
 			// FMemoryWriter 创建一个内存写入流，指向 SavedActor.Bytes 这个字节数组。
@@ -211,23 +234,10 @@ void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& Destination
 			FObjectAndNameAsStringProxyArchive Archive(MemoryWriter, true);
 			Archive.ArIsSaveGame = true;
 			Actor->Serialize(Archive);// Actor 将自己的 SaveGame 属性写入到 SavedActor.Bytes 中。
-
-			// 将打包好的 Actor 数据添加到地图存档中。
-			SavedMap.SavedActors.AddUnique(SavedActor);
-			
-		}
-		// 步骤 4/5: 将修改后的地图数据写回存档对象
-		// (为什么这么做): `GetSavedMapWithMapName` 可能返回的是一个结构体的副本 (copy)。
-		// 所以对 `SavedMap` 的所有修改都只是在副本上，需要把这个副本写回原始的 `SaveGame->SavedMaps` 数组中。
-		for (FSavedMap& MapToReplace : SaveGame->SavedMaps)
-		{
-			if (MapToReplace.MapAssetName == WorldName)
-			{
-				MapToReplace = SavedMap;
-			}
 		}
-		// 步骤 5/5: 将包含最新世界状态的存档对象写入磁盘。
-		UGameplayStatics::SaveGameToSlot(SaveGame,AuraGI->LoadSlotName, AuraGI->LoadSlotIndex);
+		// 步骤 4/5: SavedMap 是存档对象内元素的引用，修改已直接生效，无需写回。
+		// 步骤 5/5: 请求提交会话存档（下一帧异步写盘）。
+		AuraGI->RequestSessionSave();
 	}
 }
 
@@ -236,61 +246,71 @@ void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& Destination
  * @param World 指向当前需要加载状态的世界对象。
  *
  * @par 功能说明
- * 这是 `SaveWorldState` 的逆向操作。它会加载存档文件，遍历当前关卡中所有可被加载的 Actor，
+ * 这是 `SaveWorldState` 的逆向操作。它会读取会话存档，遍历当前关卡中所有可被加载的 Actor，
  * 然后在存档数据中查找与之一一对应的记录。找到后，它会将保存的 Transform 和自定义数据
  * 反序列化回 Actor，从而恢复其之前的状态。
  */
 void AAuraGameModeBase::LoadWorldState(UWorld* World) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_AuraSave_LoadWorldState);
+
 	FString WorldName = World->GetMapName();// 同样，获取并清理地图名。
 	WorldName.RemoveFromStart(World->StreamingLevelsPrefix);
 	
+	UAuraSaveableActorRegistry* SaveableActorRegistry = UAuraSaveableActorRegistry::Get(World);
+	if (SaveableActorRegistry == nullptr) return;
+
 	UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(GetGameInstance());
 	check(AuraGI);
 
 
-	if (UGameplayStatics::DoesSaveGameExist(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex))
+	// 槽位文件不存在时会话存档是新建的空存档，没有任何地图记录，下面的循环不会命中任何 Actor。
 	{
-		ULoadScreenSaveGame* SaveGame = Cast<ULoadScreenSaveGame>(UGameplayStatics::LoadGameFromSlot(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex));
+		ULoadScreenSaveGame* SaveGame = AuraGI->GetSessionSaveGame(LoadScreenSaveGameClass);
 		if (SaveGame == nullptr)
 		{
 			UE_LOG(LogAura, Error, TEXT("加载存档失败"));
 			return;
 		}
-		// 步骤 1/3: 遍历世界中的 Actor
-		for (FActorIterator It(World); It; ++It)
+		// 本地图没有存档记录时无需加载。FindSavedMap 返回存档对象内元素的指针，不拷贝任何字节数组。
+		const FSavedMap* SavedMap = SaveGame->FindSavedMap(WorldName);
+		if (SavedMap == nullptr) return;
+
+		// 步骤 1/3: 遍历注册表中的可保存 Actor
+		// (为什么这么做): LoadActor 中 Actor 可能销毁自己（例如已触发过的刷怪区域），EndPlay 时会从注册表注销，
+		// 所以这里遍历一份拷贝（只有几十个弱引用）。
+		const TArray<TWeakObjectPtr<AActor>> SaveableActors = SaveableActorRegistry->GetSaveableActors();
+		for (const TWeakObjectPtr<AActor>& SaveableActor : SaveableActors)
 		{
-			AActor* Actor = *It;
-			if (!Actor->Implements<USaveInterface>()) continue;
+			INC_DWORD_STAT(STAT_AuraSave_ActorsVisited);
+			AActor* Actor = SaveableActor.Get();
+			if (!IsValid(Actor)) continue;
 
 			// 步骤 2/3: 在存档数据中查找匹配的 Actor
-			// 这里是一个嵌套循环，遍历本地图存档中的每一个 Actor 记录。
-			for (FSavedActor SavedActor : SaveGame->GetSavedMapWithMapName(WorldName).SavedActors)
+			// 通过 Actor 的唯一名称 FName 在索引中查找（O(1)），找不到说明该 Actor 从未被保存过。
+			const FSavedActor* SavedActor = SavedMap->FindSavedActor(Actor->GetFName());
+			if (SavedActor == nullptr) continue;
+
+			// 步骤 3/3: 应用数据
+			// (为什么这么做): 通过接口调用 Actor 自身的函数，让 Actor 自己决定是否要加载 Transform。
+			// 例如，一个敌人可能在被杀死后保存了位置，但我们希望它在加载时重新从刷新点出现，这时就应该返回 false。
+			if (ISaveInterface::Execute_ShouldLoadTransform(Actor))
 			{
-				// 通过 Actor 的唯一名称 FName 进行匹配。
-				if (SavedActor.ActorName == Actor->GetFName())
-				{
-					// 步骤 3/3: 应用数据
-					// (为什么这么做): 通过接口调用 Actor 自身的函数，让 Actor 自己决定是否要加载 Transform。
-					// 例如，一个敌人可能在被杀死后保存了位置，但我们希望它在加载时重新从刷新点出现，这时就应该返回 false。
-					if (ISaveInterface::Execute_ShouldLoadTransform(Actor))
-					{
-						Actor->SetActorTransform(SavedActor.Transform);
-					}
-					// 这是反序列化过程，与保存时完全对应。
-					// FMemoryReader 从保存的字节数组中读取数据。
-					// Archive 被配置为加载模式。
-					// Actor->Serialize(Archive) 会从流中读取数据，并填充到自己的 SaveGame 属性中。
-					FMemoryReader MemoryReader(SavedActor.Bytes);
-					FObjectAndNameAsStringProxyArchive Archive(MemoryReader, true);
-					Archive.ArIsSaveGame = true;
-					Actor->Serialize(Archive);
-
-					// (为什么这么做): 这是一个“加载后”的回调。在所有数据都恢复后，调用接口的 LoadActor 函数。
-					// Actor 可以在这个函数里执行一些额外的逻辑，比如根据新加载的 bIsOpened 状态来更新自己的模型或材质。
-					ISaveInterface::Execute_LoadActor(Actor);
-				}
+				Actor->SetActorTransform(SavedActor->Transform);
 			}
+			// 这是反序列化过程，与保存时完全对应。
+			// FMemoryReader 从保存的字节数组中读取数据。
+			// Archive 被配置为加载模式。
+			// Actor->Serialize(Archive) 会从流中读取数据，并填充到自己的 SaveGame 属性中。
+			FMemoryReader MemoryReader(SavedActor->Bytes);
+			FObjectAndNameAsStringProxyArchive Archive(MemoryReader, true);
+			Archive.ArIsSaveGame = true;
+			Actor->Serialize(Archive);
+
+			// (为什么这么做): 这是一个“加载后”的回调。在所有数据都恢复后，调用接口的 LoadActor 函数。
+			// Actor 可以在这个函数里执行一些额外的逻辑，比如根据新加载的 bIsOpened 状态来更新自己的模型或材质。
+			ISaveInterface::Execute_LoadActor(Actor);
+			INC_DWORD_STAT(STAT_AuraSave_ActorsLoaded);
 		}
 	}
 	
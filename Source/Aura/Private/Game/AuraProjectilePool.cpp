@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraProjectilePool.h"
+
+#include "Actor/AuraProjectile.h"
+
+DECLARE_STATS_GROUP(TEXT("AuraProjectilePool"), STATGROUP_AuraProjectilePool, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reused Projectiles"), STAT_AuraProjectilePool_Reused, STATGROUP_AuraProjectilePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawned Projectiles"), STAT_AuraProjectilePool_Spawned, STATGROUP_AuraProjectilePool);
+
+UAuraProjectilePool* UAuraProjectilePool::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UAuraProjectilePool>();
+	}
+	return nullptr;
+}
+
+bool UAuraProjectilePool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraProjectilePool::Deinitialize()
+{
+	Buckets.Empty();
+	Super::Deinitialize();
+}
+
+/**
+ * @brief 取出一个可用的投射物（空闲实例优先，否则延迟生成新实例）
+ *
+ * @param ProjectileClass 投射物类
+ * @param SpawnTransform  生成变换（复用的实例在 FinishSpawningProjectile 时才移动到此处）
+ * @param Owner           拥有者
+ * @param Instigator      实例化者
+ * @return 尚未激活的投射物；调用方写入伤害参数等之后必须调用 FinishSpawningProjectile
+ */
+AAuraProjectile* UAuraProjectilePool::SpawnProjectileDeferred(TSubclassOf<AAuraProjectile> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+{
+	if (ProjectileClass == nullptr) return nullptr;
+
+	if (FAuraProjectilePoolBucket* Bucket = Buckets.Find(ProjectileClass.Get()))
+	{
+		while (!Bucket->FreeProjectiles.IsEmpty())
+		{
+			AAuraProjectile* Projectile = Bucket->FreeProjectiles.Pop(EAllowShrinking::No);
+			// 被外部销毁的实例直接丢弃
+			if (!IsValid(Projectile)) continue;
+
+			Projectile->SetOwner(Owner);
+			Projectile->SetInstigator(Instigator);
+			INC_DWORD_STAT(STAT_AuraProjectilePool_Reused);
+			return Projectile;
+		}
+	}
+
+	return SpawnPooledProjectile(ProjectileClass, SpawnTransform, Owner, Instigator, true);
+}
+
+void UAuraProjectilePool::FinishSpawningProjectile(AAuraProjectile* Projectile, const FTransform& SpawnTransform)
+{
+	if (!IsValid(Projectile)) return;
+
+	if (Projectile->HasActorBegunPlay())
+	{
+		Projectile->ActivateFromPool(SpawnTransform);
+	}
+	else
+	{
+		Projectile->FinishSpawning(SpawnTransform);
+	}
+}
+
+/**
+ * @brief 停用投射物并放回对应类的空闲列表；空闲列表已满时直接销毁
+ */
+void UAuraProjectilePool::ReleaseProjectile(AAuraProjectile* Projectile)
+{
+	if (!IsValid(Projectile)) return;
+
+	FAuraProjectilePoolBucket& Bucket = Buckets.FindOrAdd(Projectile->GetClass());
+	if (Bucket.FreeProjectiles.Num() >= MaxPooledPerClass)
+	{
+		Projectile->Destroy();
+		return;
+	}
+
+	Projectile->DeactivateForPool();
+	Bucket.FreeProjectiles.Add(Projectile);
+}
+
+void UAuraProjectilePool::PrewarmProjectiles(TSubclassOf<AAuraProjectile> ProjectileClass, int32 Count)
+{
+	if (ProjectileClass == nullptr) return;
+
+	FAuraProjectilePoolBucket& Bucket = Buckets.FindOrAdd(ProjectileClass.Get());
+	const int32 TargetCount = FMath::Min(Count, MaxPooledPerClass);
+	Bucket.FreeProjectiles.Reserve(TargetCount);
+	while (Bucket.FreeProjectiles.Num() < TargetCount)
+	{
+		AAuraProjectile* Projectile = SpawnPooledProjectile(ProjectileClass, FTransform::Identity, nullptr, nullptr, false);
+		if (Projectile == nullptr) return;
+
+		Projectile->FinishSpawning(FTransform::Identity);
+		Bucket.FreeProjectiles.Add(Projectile);
+	}
+}
+
+/**
+ * @brief 延迟生成一个由对象池管理的投射物
+ *
+ * @param bStartActive false 表示预热实例：BeginPlay 时直接进入停用状态
+ */
+AAuraProjectile* UAuraProjectilePool::SpawnPooledProjectile(TSubclassOf<AAuraProjectile> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator, bool bStartActive)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return nullptr;
+
+	AAuraProjectile* Projectile = World->SpawnActorDeferred<AAuraProjectile>(
+		ProjectileClass,
+		SpawnTransform,
+		Owner,
+		Instigator,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (Projectile == nullptr) return nullptr;
+
+	Projectile->InitPooled(bStartActive);
+	INC_DWORD_STAT(STAT_AuraProjectilePool_Spawned);
+	return Projectile;
+}
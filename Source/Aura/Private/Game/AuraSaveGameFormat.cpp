@@ -0,0 +1,522 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraSaveGameFormat.h"
+
+#include "Async/Async.h"
+#include "Aura/AuraLogChannels.h"
+#include "Engine/World.h"
+#include "Game/AuraGameInstance.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "GameFramework/SaveGame.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Serialization/ArchiveProxy.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectVersion.h"
+#include "UObject/SoftObjectPtr.h"
+
+DECLARE_STATS_GROUP(TEXT("AuraSaveFormat"), STATGROUP_AuraSaveFormat, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Serialize Save Payload"), STAT_AuraSave_SerializePayload, STATGROUP_AuraSaveFormat);
+DECLARE_CYCLE_STAT(TEXT("Encode Save File"), STAT_AuraSave_EncodeFile, STATGROUP_AuraSaveFormat);
+DECLARE_CYCLE_STAT(TEXT("Load Save File"), STAT_AuraSave_LoadFromMemory, STATGROUP_AuraSaveFormat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Last Save Payload Bytes"), STAT_AuraSave_PayloadBytes, STATGROUP_AuraSaveFormat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Last Save File Bytes"), STAT_AuraSave_FileBytes, STATGROUP_AuraSaveFormat);
+
+namespace AuraSaveGameFormat
+{
+	// "AURS"：与引擎 SaveGame 文件头的 "SAVG" 区分，用于识别旧格式
+	constexpr uint32 FileMagic = 0x53525541;
+
+	// 负载原始大小的上限：绝对上限，以及相对文件中压缩数据大小的最大压缩比
+	constexpr int32 MaxPayloadSize = 256 * 1024 * 1024;
+	constexpr int64 MaxCompressionRatio = 1024;
+
+	enum class ECompression : uint8
+	{
+		None,
+		Zlib,
+		Oodle
+	};
+
+	FName GetCompressionFormatName(ECompression Compression)
+	{
+		switch (Compression)
+		{
+		case ECompression::Zlib:  return NAME_Zlib;
+		case ECompression::Oodle: return NAME_Oodle;
+		default:                  return NAME_None;
+		}
+	}
+
+	/**
+	 * 写入时把 FName 与对象引用替换为名称表下标
+	 *
+	 * 注意事项：
+	 * - 名称表按字符串去重（与 FName 一样不区分大小写）；
+	 * - 对象引用写成路径，读取时按路径查找/加载，语义与 FObjectAndNameAsStringProxyArchive 一致。
+	 */
+	class FNameTableWriter : public FArchiveProxy
+	{
+	public:
+		FNameTableWriter(FArchive& InInnerArchive, TArray<FString>& InNameTable)
+			: FArchiveProxy(InInnerArchive)
+			, NameTable(InNameTable)
+		{
+		}
+
+		using FArchiveProxy::operator<<;
+
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			WriteString(Value.ToString());
+			return *this;
+		}
+
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			WriteString(Value ? FSoftObjectPath(Value).ToString() : FString());
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FObjectPtr& Value) override
+		{
+			UObject* Object = Value.Get();
+			return *this << Object;
+		}
+
+		virtual FArchive& operator<<(FWeakObjectPtr& Value) override
+		{
+			UObject* Object = Value.Get();
+			return *this << Object;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			WriteString(Value.ToString());
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPtr& Value) override
+		{
+			WriteString(Value.ToSoftObjectPath().ToString());
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("AuraSaveGameFormat::FNameTableWriter"); }
+
+	private:
+		TArray<FString>& NameTable;
+		TMap<FString, uint32> NameToIndex;
+
+		void WriteString(const FString& String)
+		{
+			uint32 Index = 0;
+			if (const uint32* ExistingIndex = NameToIndex.Find(String))
+			{
+				Index = *ExistingIndex;
+			}
+			else
+			{
+				Index = NameTable.Add(String);
+				NameToIndex.Add(String, Index);
+			}
+			SerializeIntPacked(Index);
+		}
+	};
+
+	//读取时按名称表下标还原 FName 与对象引用
+	class FNameTableReader : public FArchiveProxy
+	{
+	public:
+		FNameTableReader(FArchive& InInnerArchive, const TArray<FString>& InNameTable)
+			: FArchiveProxy(InInnerArchive)
+			, NameTable(InNameTable)
+		{
+		}
+
+		using FArchiveProxy::operator<<;
+
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			const FString* String = ReadString();
+			Value = String ? FName(**String) : NAME_None;
+			return *this;
+		}
+
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			const FString* String = ReadString();
+			Value = (String && !String->IsEmpty()) ? FSoftObjectPath(*String).TryLoad() : nullptr;
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FObjectPtr& Value) override
+		{
+			UObject* Object = nullptr;
+			*this << Object;
+			Value = FObjectPtr(Object);
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FWeakObjectPtr& Value) override
+		{
+			UObject* Object = nullptr;
+			*this << Object;
+			Value = Object;
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			const FString* String = ReadString();
+			Value = String ? FSoftObjectPath(*String) : FSoftObjectPath();
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPtr& Value) override
+		{
+			FSoftObjectPath Path;
+			*this << Path;
+			Value = FSoftObjectPtr(Path);
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("AuraSaveGameFormat::FNameTableReader"); }
+
+	private:
+		const TArray<FString>& NameTable;
+
+		const FString* ReadString()
+		{
+			uint32 Index = 0;
+			SerializeIntPacked(Index);
+			if (!NameTable.IsValidIndex(Index))
+			{
+				SetError();
+				return nullptr;
+			}
+			return &NameTable[Index];
+		}
+	};
+}
+
+bool FAuraSaveGameFormat::SaveToSlot(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex)
+{
+	TArray<uint8> Data;
+	if (!SaveToMemory(SaveGame, Data)) return false;
+
+	return WriteSlot(IPlatformFeaturesModule::Get().GetSaveGameSystem(), SlotName, UserIndex, Data);
+}
+
+/**
+ * @brief 异步保存到槽位
+ *
+ * 详细流程：
+ * 1) 游戏线程：把存档对象序列化为未压缩负载（只有这一步需要访问 UObject）；
+ * 2) 后台线程：压缩、计算校验并写入平台存档系统；
+ * 3) 回到游戏线程调用 OnComplete。
+ */
+FGraphEventRef FAuraSaveGameFormat::AsyncSaveToSlot(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex, TFunction<void(bool)> OnComplete)
+{
+	TSharedRef<TArray<uint8>> Payload = MakeShared<TArray<uint8>>();
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (SaveSystem == nullptr || SlotName.IsEmpty() || !SerializePayload(SaveGame, *Payload))
+	{
+		if (OnComplete) OnComplete(false);
+		return FGraphEventRef();
+	}
+
+	return FFunctionGraphTask::CreateAndDispatchWhenReady([Payload, SaveSystem, SlotName, UserIndex, OnComplete = MoveTemp(OnComplete)]()
+	{
+		TArray<uint8> Data;
+		EncodeFile(*Payload, Data);
+		const bool bSuccess = WriteSlot(SaveSystem, SlotName, UserIndex, Data);
+
+		AsyncTask(ENamedThreads::GameThread, [bSuccess, OnComplete]()
+		{
+			if (OnComplete) OnComplete(bSuccess);
+		});
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+USaveGame* FAuraSaveGameFormat::LoadFromSlot(const FString& SlotName, int32 UserIndex)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (SaveSystem == nullptr || SlotName.IsEmpty()) return nullptr;
+
+	TArray<uint8> Data;
+	if (!SaveSystem->LoadGame(false, *SlotName, UserIndex, Data)) return nullptr;
+
+	return LoadFromMemory(Data);
+}
+
+bool FAuraSaveGameFormat::SaveToMemory(USaveGame* SaveGame, TArray<uint8>& OutData)
+{
+	TArray<uint8> Payload;
+	if (!SerializePayload(SaveGame, Payload)) return false;
+
+	EncodeFile(Payload, OutData);
+	return true;
+}
+
+/**
+ * @brief 从内存读取存档
+ *
+ * 详细流程：
+ * 1) 没有 "AURS" 文件头：旧格式，交给引擎的 LoadGameFromMemory 读取（迁移：下次保存时写成新格式）；
+ * 2) 校验格式版本与压缩算法，解压并比对 CRC32；
+ * 3) 读取引擎包版本与 CustomVersion 并设置到读取档案上，再读取存档类路径与名称表；
+ * 4) 创建存档对象并按属性标签（tagged property）读取所有 UPROPERTY（新增/删除的属性按标签跳过，与引擎默认格式的兼容性一致）。
+ */
+USaveGame* FAuraSaveGameFormat::LoadFromMemory(const TArray<uint8>& Data)
+{
+	using namespace AuraSaveGameFormat;
+	SCOPE_CYCLE_COUNTER(STAT_AuraSave_LoadFromMemory);
+
+	FMemoryReader HeaderReader(Data, true);
+	uint32 Magic = 0;
+	if (Data.Num() >= static_cast<int32>(sizeof(Magic)))
+	{
+		HeaderReader << Magic;
+	}
+	if (Magic != FileMagic)
+	{
+		return UGameplayStatics::LoadGameFromMemory(Data);
+	}
+
+	uint32 FormatVersion = 0;
+	uint8 Compression = 0;
+	int32 UncompressedSize = 0;
+	uint32 PayloadCrc = 0;
+	HeaderReader << FormatVersion << Compression << UncompressedSize << PayloadCrc;
+	if (HeaderReader.IsError() || UncompressedSize < 0)
+	{
+		UE_LOG(LogAura, Error, TEXT("Save file header is corrupt"));
+		return nullptr;
+	}
+	if (FormatVersion == static_cast<uint32>(EAuraSaveFormatVersion::Legacy) || FormatVersion > static_cast<uint32>(EAuraSaveFormatVersion::Latest))
+	{
+		UE_LOG(LogAura, Error, TEXT("Unsupported save format version %u"), FormatVersion);
+		return nullptr;
+	}
+
+	const int64 PayloadOffset = HeaderReader.Tell();
+	const int32 StoredSize = Data.Num() - static_cast<int32>(PayloadOffset);
+	// 分配前校验文件头中的原始大小，损坏的文件头不能触发超大分配
+	if (UncompressedSize > MaxPayloadSize || static_cast<int64>(UncompressedSize) > static_cast<int64>(StoredSize) * MaxCompressionRatio)
+	{
+		UE_LOG(LogAura, Error, TEXT("Save file payload size %d is too large for %d stored bytes"), UncompressedSize, StoredSize);
+		return nullptr;
+	}
+	TArray<uint8> Payload;
+	if (static_cast<ECompression>(Compression) == ECompression::None)
+	{
+		if (StoredSize != UncompressedSize)
+		{
+			UE_LOG(LogAura, Error, TEXT("Save file payload is truncated"));
+			return nullptr;
+		}
+		Payload.Append(Data.GetData() + PayloadOffset, StoredSize);
+	}
+	else
+	{
+		const FName FormatName = GetCompressionFormatName(static_cast<ECompression>(Compression));
+		Payload.SetNumUninitialized(UncompressedSize);
+		if (FormatName.IsNone() || !FCompression::UncompressMemory(FormatName, Payload.GetData(), UncompressedSize, Data.GetData() + PayloadOffset, StoredSize))
+		{
+			UE_LOG(LogAura, Error, TEXT("Failed to decompress save file"));
+			return nullptr;
+		}
+	}
+	if (FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != PayloadCrc)
+	{
+		UE_LOG(LogAura, Error, TEXT("Save file checksum mismatch"));
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Payload, true);
+	int32 FileVersionUE4 = 0;
+	int32 FileVersionUE5 = 0;
+	int32 LicenseeVersion = 0;
+	Reader << FileVersionUE4 << FileVersionUE5 << LicenseeVersion;
+	FCustomVersionContainer CustomVersions;
+	CustomVersions.Serialize(Reader, ECustomVersionSerializationFormat::Latest);
+	FString SaveGameClassPath;
+	Reader << SaveGameClassPath;
+	TArray<FString> NameTable;
+	Reader << NameTable;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogAura, Error, TEXT("Save file payload is corrupt"));
+		return nullptr;
+	}
+
+	UClass* SaveGameClass = FSoftClassPath(SaveGameClassPath).TryLoadClass<USaveGame>();
+	if (SaveGameClass == nullptr)
+	{
+		UE_LOG(LogAura, Error, TEXT("Save game class %s not found"), *SaveGameClassPath);
+		return nullptr;
+	}
+	USaveGame* SaveGame = NewObject<USaveGame>(GetTransientPackage(), SaveGameClass);
+
+	// 存档对象数据紧跟在名称表之后，直接在负载上继续读取，不再拷贝
+	FMemoryReader BodyReader(Payload, true);
+	BodyReader.Seek(Reader.Tell());
+	BodyReader.SetUEVer(FPackageFileVersion(FileVersionUE4, static_cast<EUnrealEngineObjectUE5Version>(FileVersionUE5)));
+	BodyReader.SetLicenseeUEVer(LicenseeVersion);
+	BodyReader.SetCustomVersions(CustomVersions);
+
+	FNameTableReader Archive(BodyReader, NameTable);
+	Archive.ArNoDelta = true;
+	SaveGame->Serialize(Archive);
+	if (Archive.IsError())
+	{
+		UE_LOG(LogAura, Error, TEXT("Failed to read save game %s"), *SaveGameClassPath);
+		return nullptr;
+	}
+	return SaveGame;
+}
+
+bool FAuraSaveGameFormat::SerializePayload(USaveGame* SaveGame, TArray<uint8>& OutPayload)
+{
+	using namespace AuraSaveGameFormat;
+	SCOPE_CYCLE_COUNTER(STAT_AuraSave_SerializePayload);
+
+	if (!IsValid(SaveGame)) return false;
+
+	TArray<FString> NameTable;
+	TArray<uint8> Body;
+	{
+		FMemoryWriter BodyWriter(Body, true);
+		FNameTableWriter Archive(BodyWriter, NameTable);
+		// 不设置 ArIsSaveGame：存档类的字段都是普通 UPROPERTY（没有 SaveGame 标记），设置后会全部被跳过。
+		// 与引擎的 SaveGameToMemory 一致，只有 Actor 数据块（FSavedActor::Bytes）才按 SaveGame 标记筛选。
+		Archive.ArNoDelta = true;
+		SaveGame->Serialize(Archive);
+		if (Archive.IsError()) return false;
+	}
+
+	OutPayload.Reset();
+	FMemoryWriter Writer(OutPayload, true);
+	int32 FileVersionUE4 = GPackageFileUEVersion.FileVersionUE4;
+	int32 FileVersionUE5 = GPackageFileUEVersion.FileVersionUE5;
+	int32 LicenseeVersion = GPackageFileLicenseeUEVersion;
+	Writer << FileVersionUE4 << FileVersionUE5 << LicenseeVersion;
+	FCustomVersionContainer CustomVersions = FCurrentCustomVersions::GetAll();
+	CustomVersions.Serialize(Writer, ECustomVersionSerializationFormat::Latest);
+	FString SaveGameClassPath = SaveGame->GetClass()->GetPathName();
+	Writer << SaveGameClassPath;
+	Writer << NameTable;
+	Writer.Serialize(Body.GetData(), Body.Num());
+	return !Writer.IsError();
+}
+
+void FAuraSaveGameFormat::EncodeFile(const TArray<uint8>& Payload, TArray<uint8>& OutData)
+{
+	using namespace AuraSaveGameFormat;
+	SCOPE_CYCLE_COUNTER(STAT_AuraSave_EncodeFile);
+
+	// Oodle 优先，失败时依次回退为 Zlib、不压缩
+	ECompression Compression = ECompression::None;
+	TArray<uint8> Compressed;
+	int32 CompressedSize = 0;
+	for (const ECompression Candidate : { ECompression::Oodle, ECompression::Zlib })
+	{
+		const FName FormatName = GetCompressionFormatName(Candidate);
+		CompressedSize = FCompression::CompressMemoryBound(FormatName, Payload.Num());
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(FormatName, Compressed.GetData(), CompressedSize, Payload.GetData(), Payload.Num()))
+		{
+			Compression = Candidate;
+			break;
+		}
+	}
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData, true);
+	uint32 Magic = FileMagic;
+	uint32 FormatVersion = static_cast<uint32>(EAuraSaveFormatVersion::Latest);
+	uint8 CompressionByte = static_cast<uint8>(Compression);
+	int32 UncompressedSize = Payload.Num();
+	uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+	Writer << Magic << FormatVersion << CompressionByte << UncompressedSize << PayloadCrc;
+
+	if (Compression == ECompression::None)
+	{
+		OutData.Append(Payload);
+	}
+	else
+	{
+		OutData.Append(Compressed.GetData(), CompressedSize);
+	}
+
+	SET_DWORD_STAT(STAT_AuraSave_PayloadBytes, Payload.Num());
+	SET_DWORD_STAT(STAT_AuraSave_FileBytes, OutData.Num());
+	UE_LOG(LogAura, Verbose, TEXT("Encoded save: %d bytes payload -> %d bytes file (compression %d)"), Payload.Num(), OutData.Num(), static_cast<int32>(Compression));
+}
+
+bool FAuraSaveGameFormat::WriteSlot(ISaveGameSystem* SaveSystem, const FString& SlotName, int32 UserIndex, const TArray<uint8>& Data)
+{
+	if (SaveSystem == nullptr || SlotName.IsEmpty()) return false;
+
+	return SaveSystem->SaveGame(false, *SlotName, UserIndex, Data);
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * @brief 控制台命令：用当前会话存档对比旧格式（引擎 SaveGameToMemory）与本格式的大小与读写耗时
+ *
+ * 用法：Aura.Debug.SaveFormatBenchmark [Iterations]（默认 20 次，取平均）
+ *
+ * 注意事项：
+ * - 只在内存中编码/解码，不写盘，不修改会话存档；
+ * - 本格式的保存时间包含序列化与压缩（即 AsyncSaveToSlot 游戏线程 + 后台线程的总耗时）。
+ */
+static FAutoConsoleCommandWithWorldAndArgs CVarAuraSaveFormatBenchmark(
+	TEXT("Aura.Debug.SaveFormatBenchmark"),
+	TEXT("Encodes the session save with the legacy and the Aura save format and logs bytes and save/load times."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UAuraGameInstance* AuraGameInstance = World ? World->GetGameInstance<UAuraGameInstance>() : nullptr;
+		ULoadScreenSaveGame* SaveGame = AuraGameInstance ? AuraGameInstance->GetSessionSaveGame(nullptr) : nullptr;
+		if (SaveGame == nullptr)
+		{
+			UE_LOG(LogAura, Warning, TEXT("Aura.Debug.SaveFormatBenchmark: no session save is loaded"));
+			return;
+		}
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+
+		auto Measure = [Iterations](TFunctionRef<void()> Function) -> double
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				Function();
+			}
+			return (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+		};
+
+		TArray<uint8> LegacyData;
+		const double LegacySaveMs = Measure([&]()
+		{
+			LegacyData.Reset();
+			UGameplayStatics::SaveGameToMemory(SaveGame, LegacyData);
+		});
+		const double LegacyLoadMs = Measure([&]() { UGameplayStatics::LoadGameFromMemory(LegacyData); });
+
+		TArray<uint8> AuraData;
+		const double AuraSaveMs = Measure([&]() { FAuraSaveGameFormat::SaveToMemory(SaveGame, AuraData); });
+		const double AuraLoadMs = Measure([&]() { FAuraSaveGameFormat::LoadFromMemory(AuraData); });
+
+		UE_LOG(LogAura, Display, TEXT("Save format benchmark (%d maps, %d iterations):"), SaveGame->SavedMaps.Num(), Iterations);
+		UE_LOG(LogAura, Display, TEXT("  Legacy: %8d bytes, save %.3f ms, load %.3f ms"), LegacyData.Num(), LegacySaveMs, LegacyLoadMs);
+		UE_LOG(LogAura, Display, TEXT("  Aura:   %8d bytes, save %.3f ms, load %.3f ms (%.1f%% of legacy size)"),
+			AuraData.Num(), AuraSaveMs, AuraLoadMs, LegacyData.Num() > 0 ? 100.0 * AuraData.Num() / LegacyData.Num() : 0.0);
+	}));
+#endif
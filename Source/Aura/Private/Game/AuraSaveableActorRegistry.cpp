@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraSaveableActorRegistry.h"
+
+#include "Interation/SaveInterface.h"
+
+UAuraSaveableActorRegistry* UAuraSaveableActorRegistry::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UAuraSaveableActorRegistry>();
+	}
+	return nullptr;
+}
+
+bool UAuraSaveableActorRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraSaveableActorRegistry::Deinitialize()
+{
+	SaveableActors.Empty();
+	DirtyActors.Empty();
+	Super::Deinitialize();
+}
+
+void UAuraSaveableActorRegistry::RegisterSaveableActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || !Actor->Implements<USaveInterface>()) return;
+
+	SaveableActors.AddUnique(Actor);
+}
+
+void UAuraSaveableActorRegistry::UnregisterSaveableActor(AActor* Actor)
+{
+	DirtyActors.Remove(Actor);
+	// 同时清理已失效的弱引用
+	SaveableActors.RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Actor;
+	});
+}
+
+void UAuraSaveableActorRegistry::MarkSaveableActorDirty(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	DirtyActors.Add(Actor);
+}
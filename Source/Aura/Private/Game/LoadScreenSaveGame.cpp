@@ -9,7 +9,7 @@
  * @return 如果找到，返回包含该地图所有已保存 Actor 数据的 FSavedMap 结构体副本。如果找不到，返回一个默认构造的、空的 FSavedMap。
  *
  * @par 功能说明
- * 这是一个 getter 函数，它遍历 `SavedMaps` 数组，通过字符串比较来查找特定地图的存档记录。
+ * 这是一个 getter 函数，通过按地图名建立的索引查找特定地图的存档记录。只需读取时请使用不拷贝的 `FindSavedMap`。
  *
  * @par 注意事项
  * - 该函数按值返回（pass-by-value）一个 `FSavedMap` 结构体。这意味着调用者得到的是一个**副本**。对这个返回的副本进行任何修改，都**不会**影响到 `ULoadScreenSaveGame` 对象中原始的 `SavedMaps` 数组里的数据。
@@ -17,18 +17,12 @@
  */
 FSavedMap ULoadScreenSaveGame::GetSavedMapWithMapName(const FString& InMapName)
 {
-	// 遍历 `SavedMaps` 这个 TArray 数组中的每一个 `FSavedMap` 元素。
-	// `const FSavedMap& Map` 表示我们以只读引用的方式访问每个元素，避免了不必要的拷贝，效率更高。
-	for (const FSavedMap& Map : SavedMaps)
+	// 通过索引查找，找到则返回该元素的副本。
+	if (const FSavedMap* SavedMap = FindSavedMap(InMapName))
 	{
-		// 比较当前遍历到的地图记录的名称和我们想要查找的名称。
-		if (Map.MapAssetName == InMapName)
-		{
-			// 如果找到了匹配项，立即返回该元素的副本。函数执行到此结束。
-			return Map;
-		}
+		return *SavedMap;
 	}
-	// 如果遍历完整个数组都没有找到匹配的地图名，则返回一个用默认构造函数创建的、空的 FSavedMap 实例。
+	// 如果没有找到匹配的地图名，则返回一个用默认构造函数创建的、空的 FSavedMap 实例。
 	return FSavedMap();
 }
 
@@ -42,16 +36,93 @@ FSavedMap ULoadScreenSaveGame::GetSavedMapWithMapName(const FString& InMapName)
  */
 bool ULoadScreenSaveGame::HasMap(const FString& InMapName)
 {
-	// 遍历逻辑与上一个函数完全相同。
-	for (const FSavedMap& Map : SavedMaps)
+	return FindSavedMap(InMapName) != nullptr;
+}
+
+/**
+ * @brief 根据地图名查找地图存档（不拷贝）
+ * @param InMapName 地图资源名称
+ * @return 指向 SavedMaps 中元素的指针；找不到时返回 nullptr。SavedMaps 增删元素后指针失效。
+ */
+const FSavedMap* ULoadScreenSaveGame::FindSavedMap(const FString& InMapName) const
+{
+	ConditionalRebuildSavedMapIndex();
+	const int32* Index = SavedMapIndex.Find(FName(*InMapName));
+	return Index ? &SavedMaps[*Index] : nullptr;
+}
+
+FSavedMap& ULoadScreenSaveGame::FindOrAddSavedMap(const FString& InMapName)
+{
+	ConditionalRebuildSavedMapIndex();
+	if (const int32* Index = SavedMapIndex.Find(FName(*InMapName)))
+	{
+		return SavedMaps[*Index];
+	}
+
+	const int32 NewIndex = SavedMaps.AddDefaulted();
+	SavedMaps[NewIndex].MapAssetName = InMapName;
+	SavedMapIndex.Add(FName(*InMapName), NewIndex);
+	return SavedMaps[NewIndex];
+}
+
+/**
+ * @brief 索引与数组数量不一致时按数组重建索引
+ *
+ * 注意事项：
+ * - 索引不参与序列化，从磁盘读取的存档首次查询时重建一次；
+ * - 直接修改 SavedMaps 数组（而不是通过 FindOrAddSavedMap）时，数量变化会触发重建；同数量下的重排不会被发现，应避免。
+ */
+void ULoadScreenSaveGame::ConditionalRebuildSavedMapIndex() const
+{
+	if (SavedMapIndex.Num() == SavedMaps.Num()) return;
+
+	SavedMapIndex.Reset();
+	SavedMapIndex.Reserve(SavedMaps.Num());
+	for (int32 Index = 0; Index < SavedMaps.Num(); ++Index)
 	{
-		// 比较地图名。
-		if (Map.MapAssetName == InMapName)
-		{
-			// 只要找到一个匹配项，就可以确定“存在”，立即返回 true。
-			return true;
-		}
+		SavedMapIndex.Add(FName(*SavedMaps[Index].MapAssetName), Index);
 	}
-	// 如果遍历完整个数组都没有找到任何匹配项，说明“不存在”，返回 false。
-	return false;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 按 Actor 名称查找已保存的数据（不拷贝）
+ * @return 指向 SavedActors 中元素的指针；找不到时返回 nullptr。SavedActors 增删元素后指针失效。
+ */
+const FSavedActor* FSavedMap::FindSavedActor(const FName& InActorName) const
+{
+	ConditionalRebuildSavedActorIndex();
+	const int32* Index = SavedActorIndex.Find(InActorName);
+	return Index ? &SavedActors[*Index] : nullptr;
+}
+
+FSavedActor& FSavedMap::FindOrAddSavedActor(const FName& InActorName)
+{
+	ConditionalRebuildSavedActorIndex();
+	if (const int32* Index = SavedActorIndex.Find(InActorName))
+	{
+		return SavedActors[*Index];
+	}
+
+	const int32 NewIndex = SavedActors.AddDefaulted();
+	SavedActors[NewIndex].ActorName = InActorName;
+	SavedActorIndex.Add(InActorName, NewIndex);
+	return SavedActors[NewIndex];
+}
+
+void FSavedMap::ResetSavedActors()
+{
+	SavedActors.Reset();
+	SavedActorIndex.Reset();
+}
+
+void FSavedMap::ConditionalRebuildSavedActorIndex() const
+{
+	if (SavedActorIndex.Num() == SavedActors.Num()) return;
+
+	SavedActorIndex.Reset();
+	SavedActorIndex.Reserve(SavedActors.Num());
+	for (int32 Index = 0; Index < SavedActors.Num(); ++Index)
+	{
+		SavedActorIndex.Add(SavedActors[Index].ActorName, Index);
+	}
+}
@@ -3,5 +3,16 @@
 
 #include "Interation/SaveInterface.h"
 
+#include "Game/AuraSaveableActorRegistry.h"
+
 
 // Add default functionality here for any ISaveInterface functions that are not pure virtual.
+
+void ISaveInterface::MarkSaveDirty()
+{
+	AActor* Actor = Cast<AActor>(_getUObject());
+	if (UAuraSaveableActorRegistry* Registry = UAuraSaveableActorRegistry::Get(Actor))
+	{
+		Registry->MarkSaveableActorDirty(Actor);
+	}
+}
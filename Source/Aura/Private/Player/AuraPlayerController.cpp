@@ -7,8 +7,9 @@
 #include "AuraGamePlayTags.h"
 #include "GameplayTagContainer.h"
 #include "EnhancedInputSubsystems.h"
-#include "NavigationPath.h"
+#include "NavigationData.h"
 #include "NavigationSystem.h"
+#include "NavFilters/NavigationQueryFilter.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Actor/MagicCircle.h"
 #include "Aura/Aura.h"
@@ -21,6 +22,12 @@
 #include "Interation/HighlightInterface.h"
 #include "UI/Widget/DamageTextComponent.h"
 
+DECLARE_STATS_GROUP(TEXT("AuraPlayerController"), STATGROUP_AuraPlayerController, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("AutoRun"), STAT_AuraAutoRun, STATGROUP_AuraPlayerController);
+DECLARE_CYCLE_STAT(TEXT("CursorTrace"), STAT_AuraCursorTrace, STATGROUP_AuraPlayerController);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AutoRun Segments Evaluated"), STAT_AuraAutoRunSegmentsEvaluated, STATGROUP_AuraPlayerController);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AutoRun Global Searches"), STAT_AuraAutoRunGlobalSearches, STATGROUP_AuraPlayerController);
+
 
 AAuraPlayerController::AAuraPlayerController()
 {
@@ -103,17 +110,26 @@ void AAuraPlayerController::UpdateMagicCircleLocation()
 	}
 }
 
+/**
+ * @brief 自动行走：沿点击寻路得到的样条前进，到达目的地附近后停止
+ *
+ * 功能说明：
+ * - 以前每帧调用 FindLocationClosestToWorldLocation 与 FindDirectionClosestToWorldLocation，各自遍历整条样条的所有段；
+ * - 现在由 AdvanceAutoRunInputKey 增量跟踪当前输入键，只在当前段附近搜索，再按输入键直接取位置与方向。
+ */
 void AAuraPlayerController::AutoRun()
 {
 	// 如果 bAutoRunning 为 false，直接返回，不执行自动奔跑逻辑
 	if (!bAutoRunning) return;
+	SCOPE_CYCLE_COUNTER(STAT_AuraAutoRun);
 	// 获取当前控制的 Pawn（角色）
 	if (APawn * ControlledPawn = GetPawn())
 	{
-		// 1. 在样条曲线上找到最接近角色当前位置的点
-		const FVector LocationOnSpline = Spline->FindLocationClosestToWorldLocation(ControlledPawn->GetActorLocation(),ESplineCoordinateSpace::World);
-		// 2. 从样条曲线上找到该点的移动方向（切线方向）
-		const FVector Direction = Spline->FindDirectionClosestToWorldLocation(LocationOnSpline,ESplineCoordinateSpace::World);
+		// 1. 增量推进样条输入键（只在角色明显偏离时才全局搜索）
+		const float InputKey = AdvanceAutoRunInputKey(ControlledPawn->GetActorLocation());
+		// 2. 按输入键取样条上的位置与切线方向
+		const FVector LocationOnSpline = Spline->GetLocationAtSplineInputKey(InputKey, ESplineCoordinateSpace::World);
+		const FVector Direction = Spline->GetDirectionAtSplineInputKey(InputKey, ESplineCoordinateSpace::World);
 		// 3. 对 Pawn 添加朝着该方向的移动输入
 		ControlledPawn->AddMovementInput(Direction);
 		// 4. 计算当前位置与目标点的距离
@@ -126,6 +142,61 @@ void AAuraPlayerController::AutoRun()
 	}
 }
 
+/**
+ * @brief 增量推进自动行走的样条输入键
+ *
+ * @param PawnLocation 角色世界坐标
+ * @return float 当前应跟随的样条输入键
+ *
+ * 详细流程：
+ * 1) 只在“当前段”与“下一段”上求最近点（每段一次 InaccurateFindNearestOnSegment）；
+ * 2) 输入键只进不退，避免在折返路径上被拉回已走过的段；
+ * 3) 若最近距离超过 AutoRunDeviationThreshold（被击退、被阻挡绕行等），回退为全局搜索并以其结果重新定位。
+ *
+ * 注意事项：
+ * - 样条组件挂在控制器上，默认无缩放，局部空间距离即世界距离；
+ * - 可用 "stat AuraPlayerController" 查看每帧评估的段数与全局搜索次数。
+ */
+float AAuraPlayerController::AdvanceAutoRunInputKey(const FVector& PawnLocation)
+{
+	const int32 NumSegments = Spline->GetNumberOfSplineSegments();
+	if (NumSegments <= 0) return 0.f;
+
+	const FInterpCurveVector& PositionCurve = Spline->GetSplinePointsPosition();
+	const FVector LocalLocation = Spline->GetComponentTransform().InverseTransformPosition(PawnLocation);
+
+	// 1) 局部搜索：当前段与下一段
+	const int32 CurrentSegment = FMath::Clamp(FMath::FloorToInt(AutoRunInputKey), 0, NumSegments - 1);
+	const int32 LastSegment = FMath::Min(CurrentSegment + 1, NumSegments - 1);
+	float BestInputKey = AutoRunInputKey;
+	float BestDistanceSquared = MAX_flt;
+	for (int32 SegmentIndex = CurrentSegment; SegmentIndex <= LastSegment; ++SegmentIndex)
+	{
+		float DistanceSquared = 0.f;
+		const float SegmentInputKey = PositionCurve.InaccurateFindNearestOnSegment(LocalLocation, SegmentIndex, DistanceSquared);
+		INC_DWORD_STAT(STAT_AuraAutoRunSegmentsEvaluated);
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestInputKey = SegmentInputKey;
+		}
+	}
+
+	if (BestDistanceSquared <= FMath::Square(AutoRunDeviationThreshold))
+	{
+		// 2) 单调推进
+		AutoRunInputKey = FMath::Max(AutoRunInputKey, BestInputKey);
+	}
+	else
+	{
+		// 3) 偏离过远：全局搜索重新定位
+		AutoRunInputKey = Spline->FindInputKeyClosestToWorldLocation(PawnLocation);
+		INC_DWORD_STAT_BY(STAT_AuraAutoRunSegmentsEvaluated, NumSegments);
+		INC_DWORD_STAT(STAT_AuraAutoRunGlobalSearches);
+	}
+	return AutoRunInputKey;
+}
+
 
 
 
@@ -227,9 +298,18 @@ void AAuraPlayerController::Move(const struct FInputActionValue& InputActionValu
 	
 }
 
-//鼠标下检测跟踪
+/**
+ * @brief 鼠标下检测跟踪：更新 CursorHit 与高亮对象
+ *
+ * 功能说明：
+ * - 光标屏幕位置与相机视角都未变化时，复用上次结果（最长 CursorTraceRefreshInterval 秒），玩家静止时几乎不产生检测开销；
+ * - bAsyncCursorTrace 开启时通过 AsyncLineTraceByChannel 检测，结果在下一帧的回调中生效；
+ * - 检测结果按通道写入共享缓存；技能瞄准（TargetDataUnderMouse）使用 ECC_Target，在同一缓存中占独立条目，
+ *   光标与视角未变化时重复施法直接复用该条目，不与高亮通道混用。
+ */
 void AAuraPlayerController::CursorTrace()
 {
+	SCOPE_CYCLE_COUNTER(STAT_AuraCursorTrace);
 	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGamePlayTags::Get().Player_Block_CursorTrace))
 	{
 		UnHighlightActor(ThisActor);
@@ -238,10 +318,39 @@ void AAuraPlayerController::CursorTrace()
 		ThisActor = nullptr;
 		return;
 	}
-	//当魔法阵有效时，设置 ECC_ExcludePlayers，否则设置ECC_Visibility
-	const ECollisionChannel TraceChannel = IsValid(MagicCircle) ? ECC_ExcludePlayers : ECC_Visibility;
-	//获取光标击中的结果
+	const ECollisionChannel TraceChannel = GetCursorTraceChannel();
+
+	FCursorTraceViewKey ViewKey;
+	if (!GetCursorTraceViewKey(ViewKey)) return;
+
+	//光标与视角未变化：直接复用缓存结果
+	if (const FCursorTraceCacheEntry* CachedTrace = FindReusableCursorTrace(TraceChannel, ViewKey, true))
+	{
+		CursorHit = CachedTrace->HitResult;
+		return;
+	}
+
+	if (bAsyncCursorTrace)
+	{
+		//异步：本帧发起，下一帧在 OnAsyncCursorTraceDone 中更新 CursorHit 与高亮
+		RequestAsyncCursorTrace(TraceChannel, ViewKey);
+		return;
+	}
+
+	//同步：获取光标击中的结果并写入缓存
 	GetHitResultUnderCursor(TraceChannel,false,CursorHit);
+	StoreCursorTrace(TraceChannel, CursorHit, ViewKey);
+	UpdateHighlightFromCursorHit();
+}
+
+ECollisionChannel AAuraPlayerController::GetCursorTraceChannel() const
+{
+	//当魔法阵有效时，设置 ECC_ExcludePlayers，否则设置ECC_Visibility
+	return IsValid(MagicCircle) ? ECC_ExcludePlayers : ECC_Visibility;
+}
+
+void AAuraPlayerController::UpdateHighlightFromCursorHit()
+{
 	//如果未击中，则返回
 	if(!CursorHit.bBlockingHit)return;
 	LastActor = ThisActor;
@@ -261,8 +370,130 @@ void AAuraPlayerController::CursorTrace()
 		UnHighlightActor(LastActor);
 		HighlightActor(ThisActor);
 	}
-	
+}
+
+/**
+ * @brief 共享光标检测：优先复用缓存，否则同步检测并写入缓存
+ *
+ * @param TraceChannel          检测通道
+ * @param OutHitResult          输出：命中结果
+ * @param bAllowDeltaGatedReuse false 时只复用“本帧”结果（技能瞄准等需要精确结果的场景）
+ * @return bool 是否有阻挡命中
+ */
+bool AAuraPlayerController::GetHitResultUnderCursorCached(ECollisionChannel TraceChannel, FHitResult& OutHitResult, bool bAllowDeltaGatedReuse)
+{
+	FCursorTraceViewKey ViewKey;
+	const bool bHasViewKey = GetCursorTraceViewKey(ViewKey);
+	if (bHasViewKey)
+	{
+		if (const FCursorTraceCacheEntry* CachedTrace = FindReusableCursorTrace(TraceChannel, ViewKey, bAllowDeltaGatedReuse))
+		{
+			OutHitResult = CachedTrace->HitResult;
+			return OutHitResult.bBlockingHit;
+		}
+	}
+
+	GetHitResultUnderCursor(TraceChannel, false, OutHitResult);
+	if (bHasViewKey)
+	{
+		StoreCursorTrace(TraceChannel, OutHitResult, ViewKey);
+	}
+	return OutHitResult.bBlockingHit;
+}
 
+bool AAuraPlayerController::FCursorTraceViewKey::Equals(const FCursorTraceViewKey& Other) const
+{
+	return MousePosition.Equals(Other.MousePosition, 0.5f)
+		&& ViewLocation.Equals(Other.ViewLocation, 0.1f)
+		&& ViewRotation.Equals(Other.ViewRotation, 0.01f)
+		&& FMath::IsNearlyEqual(FOV, Other.FOV, 0.01f);
+}
+
+bool AAuraPlayerController::GetCursorTraceViewKey(FCursorTraceViewKey& OutViewKey) const
+{
+	float MouseX = 0.f;
+	float MouseY = 0.f;
+	if (PlayerCameraManager == nullptr || !GetMousePosition(MouseX, MouseY)) return false;
+
+	OutViewKey.MousePosition = FVector2D(MouseX, MouseY);
+	OutViewKey.ViewLocation = PlayerCameraManager->GetCameraLocation();
+	OutViewKey.ViewRotation = PlayerCameraManager->GetCameraRotation();
+	OutViewKey.FOV = PlayerCameraManager->GetFOVAngle();
+	return true;
+}
+
+const AAuraPlayerController::FCursorTraceCacheEntry* AAuraPlayerController::FindReusableCursorTrace(ECollisionChannel TraceChannel, const FCursorTraceViewKey& ViewKey, bool bAllowDeltaGatedReuse) const
+{
+	for (const FCursorTraceCacheEntry& Entry : CursorTraceCache)
+	{
+		if (Entry.TraceChannel != TraceChannel || !Entry.ViewKey.Equals(ViewKey)) continue;
+
+		//同一帧：总是可复用
+		if (Entry.FrameNumber == GFrameCounter) return &Entry;
+
+		//跨帧：光标与视角未变化且未超过刷新间隔
+		if (bAllowDeltaGatedReuse && GetWorld()->GetTimeSeconds() - Entry.TraceTime < CursorTraceRefreshInterval) return &Entry;
+	}
+	return nullptr;
+}
+
+void AAuraPlayerController::StoreCursorTrace(ECollisionChannel TraceChannel, const FHitResult& HitResult, const FCursorTraceViewKey& ViewKey)
+{
+	FCursorTraceCacheEntry* Entry = CursorTraceCache.FindByPredicate([TraceChannel](const FCursorTraceCacheEntry& Candidate)
+	{
+		return Candidate.TraceChannel == TraceChannel;
+	});
+	if (Entry == nullptr)
+	{
+		Entry = &CursorTraceCache.AddDefaulted_GetRef();
+		Entry->TraceChannel = TraceChannel;
+	}
+	Entry->HitResult = HitResult;
+	Entry->ViewKey = ViewKey;
+	Entry->FrameNumber = GFrameCounter;
+	Entry->TraceTime = GetWorld()->GetTimeSeconds();
+}
+
+/**
+ * @brief 发起异步光标射线（与 GetHitResultUnderCursor 相同的起点、方向与距离）
+ *
+ * 注意事项：
+ * - 上一次异步检测尚未返回时不会重复发起；
+ * - 结果记录的是发起时的视图键，之后视角若已变化，缓存自然失效并重新检测。
+ */
+void AAuraPlayerController::RequestAsyncCursorTrace(ECollisionChannel TraceChannel, const FCursorTraceViewKey& ViewKey)
+{
+	if (GetWorld()->IsTraceHandleValid(PendingCursorTraceHandle, false)) return;
+
+	FVector WorldOrigin;
+	FVector WorldDirection;
+	if (!DeprojectScreenPositionToWorld(ViewKey.MousePosition.X, ViewKey.MousePosition.Y, WorldOrigin, WorldDirection)) return;
+
+	if (!CursorTraceDelegate.IsBound())
+	{
+		CursorTraceDelegate.BindUObject(this, &AAuraPlayerController::OnAsyncCursorTraceDone);
+	}
+
+	PendingCursorTraceChannel = TraceChannel;
+	PendingCursorTraceViewKey = ViewKey;
+	PendingCursorTraceHandle = GetWorld()->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		WorldOrigin,
+		WorldOrigin + WorldDirection * HitResultTraceDistance,
+		TraceChannel,
+		FCollisionQueryParams(SCENE_QUERY_STAT(ClickableTrace), false),
+		FCollisionResponseParams::DefaultResponseParam,
+		&CursorTraceDelegate);
+}
+
+void AAuraPlayerController::OnAsyncCursorTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if (TraceHandle != PendingCursorTraceHandle) return;
+	PendingCursorTraceHandle = FTraceHandle();
+
+	CursorHit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult();
+	StoreCursorTrace(PendingCursorTraceChannel, CursorHit, PendingCursorTraceViewKey);
+	UpdateHighlightFromCursorHit();
 }
 
 void AAuraPlayerController::HighlightActor(AActor* InActor)
@@ -310,6 +541,8 @@ void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 		}
 		// 无论是否锁定，按下 LMB 都会关闭“自动奔跑”
 		bAutoRunning = false; // 停止自动寻路/奔跑
+		// 作废尚未返回的寻路结果，避免新的按下之后被旧结果重新启动自动奔跑
+		PendingPathQueryId = INVALID_NAVQUERYID;
 	}
 	// 如果 ASC 存在，则把“按下”事件透传给 ASC（用于触发/预测能力）
 	if (GetASC())
@@ -364,29 +597,8 @@ void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 				// 在点击位置播放一个 Niagara 效果，作为点击反馈
 				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ClickNiagaraSystem, CachedDestination); // 点击特效
 			}
-			// 使用导航系统同步计算从 Pawn 到 CachedDestination 的路径
-			if (UNavigationPath * NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(this,ControlledPawn->GetActorLocation(),CachedDestination)) // 查路径
-			{
-				
-				// 清空样条上的旧路径点
-				Spline->ClearSplinePoints(); // 清路径
-				// 把导航路径的各点写入样条（用于可视化或沿样条移动）
-				for (const FVector& PointLoc :NavPath->PathPoints) // 遍历路径点
-				{
-					Spline->AddSplinePoint(PointLoc,ESplineCoordinateSpace::World); // 加入样条
-				}
-				
-				// 若确实有路径点，更新最终目的地并开启自动奔跑
-				if (NavPath->PathPoints.Num() > 0)
-				{
-					// 以路径最后一个点作为最终落点
-					CachedDestination = NavPath->PathPoints[NavPath->PathPoints.Num() - 1]; // 更新目标
-					// 开启自动奔跑（Tick/其他逻辑据此沿样条前进）
-					bAutoRunning = true; // 启动自动奔跑
-				}
-			}
-			
-			
+			// 发起点击寻路（复用已有路径或异步查询，结果到达后再填充样条）
+			RequestClickToMovePath(ControlledPawn);
 		}
 	
 		// 释放后重置“按住计时”
@@ -450,6 +662,138 @@ void AAuraPlayerController::AbilityInputTagHeld(FGameplayTag InputTag)
 	}
 }
 
+/**
+ * @brief 发起一次点击寻路：先尝试复用已有路径，否则向导航系统发起异步查询
+ *
+ * @param ControlledPawn 受控角色（起点取其位置，寻路代理参数取其 NavAgentProperties）
+ *
+ * 功能说明：
+ * - 以前使用 FindPathToLocationSynchronously 在游戏线程同步寻路，大地图上的长路径会造成明显的输入卡顿；
+ * - 现在通过 FindPathAsync 交给导航系统异步计算，结果在 OnClickToMovePathFound 中写入样条；
+ * - 重复点击在旧终点附近时，直接裁剪已有路径，不再发起新的查询；复用校验失败时回退为 FindPathAsync。
+ *
+ * 注意事项：
+ * - 新查询会覆盖 PendingPathQueryId，旧查询的结果到达后会被忽略。
+ */
+void AAuraPlayerController::RequestClickToMovePath(const APawn* ControlledPawn)
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavSys == nullptr) return;
+
+	const FVector PawnLocation = ControlledPawn->GetActorLocation();
+	const FNavAgentProperties& NavAgentProperties = ControlledPawn->GetNavAgentPropertiesRef();
+	if (TryReuseClickToMovePath(PawnLocation, *NavSys, NavAgentProperties))
+	{
+		PendingPathQueryId = INVALID_NAVQUERYID;
+		ApplyClickToMovePath();
+		return;
+	}
+
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(NavAgentProperties, PawnLocation);
+	if (NavData == nullptr) return;
+
+	FPathFindingQuery Query(this, *NavData, PawnLocation, CachedDestination, UNavigationQueryFilter::GetQueryFilter(*NavData, this, nullptr));
+	PendingPathQueryId = NavSys->FindPathAsync(NavAgentProperties, Query,
+		FNavPathQueryDelegate::CreateUObject(this, &AAuraPlayerController::OnClickToMovePathFound));
+}
+
+/**
+ * @brief 复用已有路径：新目的地在旧终点 PathReuseRadius 内，且角色仍在旧路径附近时，裁剪掉已走过的部分并替换终点
+ *
+ * @param PawnLocation       角色当前位置
+ * @param NavSys             导航系统（用于校验替换后的最后一段）
+ * @param NavAgentProperties 寻路代理参数（投影新目的地时选择对应的导航数据）
+ * @return bool 复用成功返回 true（ClickToMovePathPoints 已更新）
+ *
+ * 注意事项：
+ * - 新的最后一段（倒数第二个点 → 新目的地）没有经过寻路：新目的地必须能投影到导航网格上，
+ *   且这一段的导航射线不被阻挡（例如旧终点附近的墙角、台阶边缘），否则返回 false 由调用方异步重新寻路。
+ */
+bool AAuraPlayerController::TryReuseClickToMovePath(const FVector& PawnLocation, UNavigationSystemV1& NavSys, const FNavAgentProperties& NavAgentProperties)
+{
+	if (ClickToMovePathPoints.Num() < 2) return false;
+
+	const float ReuseRadiusSquared = FMath::Square(PathReuseRadius);
+	if (FVector::DistSquared(ClickToMovePathPoints.Last(), CachedDestination) > ReuseRadiusSquared) return false;
+
+	// 找到离角色最近的路径线段
+	int32 ClosestSegment = INDEX_NONE;
+	float ClosestDistanceSquared = MAX_flt;
+	for (int32 Index = 0; Index < ClickToMovePathPoints.Num() - 1; ++Index)
+	{
+		const FVector PointOnSegment = FMath::ClosestPointOnSegment(PawnLocation, ClickToMovePathPoints[Index], ClickToMovePathPoints[Index + 1]);
+		const float DistanceSquared = FVector::DistSquared(PawnLocation, PointOnSegment);
+		if (DistanceSquared < ClosestDistanceSquared)
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestSegment = Index;
+		}
+	}
+	// 角色已偏离旧路径（例如被击退或手动移动过），需要重新寻路
+	if (ClosestDistanceSquared > ReuseRadiusSquared) return false;
+
+	// 新路径 = 角色位置 + 最近线段之后的中间点 + 新目的地
+	TArray<FVector> TrimmedPoints;
+	TrimmedPoints.Reserve(ClickToMovePathPoints.Num() - ClosestSegment + 1);
+	TrimmedPoints.Add(PawnLocation);
+	for (int32 Index = ClosestSegment + 1; Index < ClickToMovePathPoints.Num() - 1; ++Index)
+	{
+		TrimmedPoints.Add(ClickToMovePathPoints[Index]);
+	}
+
+	// 新的最后一段未经寻路：目的地投影到导航网格，并检查这一段是否畅通
+	FNavLocation ProjectedDestination;
+	if (!NavSys.ProjectPointToNavigation(CachedDestination, ProjectedDestination, INVALID_NAVEXTENT, &NavAgentProperties)) return false;
+	FVector RaycastHitLocation;
+	if (UNavigationSystemV1::NavigationRaycast(this, TrimmedPoints.Last(), ProjectedDestination.Location, RaycastHitLocation, nullptr, this)) return false;
+
+	TrimmedPoints.Add(ProjectedDestination.Location);
+	ClickToMovePathPoints = MoveTemp(TrimmedPoints);
+	return true;
+}
+
+/**
+ * @brief 异步寻路结果回调（游戏线程）：只接受最新一次查询的结果
+ */
+void AAuraPlayerController::OnClickToMovePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath)
+{
+	if (QueryId != PendingPathQueryId) return;
+	PendingPathQueryId = INVALID_NAVQUERYID;
+
+	if (Result != ENavigationQueryResult::Success || !NavPath.IsValid()) return;
+
+	const TArray<FNavPathPoint>& PathPoints = NavPath->GetPathPoints();
+	if (PathPoints.Num() == 0) return;
+
+	ClickToMovePathPoints.Reset(PathPoints.Num());
+	for (const FNavPathPoint& PathPoint : PathPoints)
+	{
+		ClickToMovePathPoints.Add(PathPoint.Location);
+	}
+	ApplyClickToMovePath();
+}
+
+/**
+ * @brief 把 ClickToMovePathPoints 写入样条（批量添加后只更新一次样条），以最后一个点为目的地开始自动奔跑
+ */
+void AAuraPlayerController::ApplyClickToMovePath()
+{
+	// 清空样条上的旧路径点
+	Spline->ClearSplinePoints(false);
+	// 把路径点写入样条（用于沿样条移动）
+	for (const FVector& PointLoc : ClickToMovePathPoints)
+	{
+		Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World, false);
+	}
+	Spline->UpdateSpline();
+	// 新路径从角色当前位置开始，跟随进度归零
+	AutoRunInputKey = 0.f;
+
+	// 以路径最后一个点作为最终落点，开启自动奔跑（Tick 据此沿样条前进）
+	CachedDestination = ClickToMovePathPoints.Last();
+	bAutoRunning = true;
+}
+
 UAuraAbilitySystemComponent* AAuraPlayerController::GetASC()
 {
 	// 如果能力组件为空
@@ -0,0 +1,188 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraAbilityTypes.h"
+#include "AuraGamePlayTags.h"
+#include "GAS/AuraAbilitySystemGlobals.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+/**
+ * Context 内存池压力测试：连续多帧、每帧 1000 次命中
+ *
+ * 功能说明：
+ * - 每帧创建 1000 个 Context（经 FGameplayEffectContextHandle 持有，与命中路径一致）、写入伤害类型并 Duplicate 一次，帧末全部释放；
+ * - 预热之后，每个 Context 块都必须来自第一帧已经见过的块集合，即池未命中（通用堆分配）为 0；
+ * - 只检查 Context 本身的块，Handle 的 TSharedPtr 控制块由引擎分配，不在池的范围内。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectContextPoolStressTest, "Aura.GAS.EffectContextPoolStress",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraEffectContextPoolStressTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 HitsPerFrame = 1000;
+	constexpr int32 NumFrames = 8;
+	// 每次命中一个原始 Context + 一个 Duplicate
+	FAuraGameplayEffectContext::ReservePool(HitsPerFrame * 2);
+
+	const FGameplayTag DamageType = FAuraGamePlayTags::Get().Damage_Fire;
+	TSet<const void*> KnownBlocks;
+	TArray<FGameplayEffectContextHandle> Handles;
+	Handles.Reserve(HitsPerFrame * 2);
+
+	int32 NumNewBlocks = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Hit = 0; Hit < HitsPerFrame; ++Hit)
+		{
+			FAuraGameplayEffectContext* Context = new FAuraGameplayEffectContext();
+			Context->SetDamageType(DamageType);
+			FGameplayEffectContextHandle& Handle = Handles.Emplace_GetRef(Context);
+			FGameplayEffectContextHandle& Duplicate = Handles.Add_GetRef(Handle.Duplicate());
+
+			for (const FGameplayEffectContextHandle* Entry : { &Handle, &Duplicate })
+			{
+				const void* Block = Entry->Get();
+				if (Frame == 0)
+				{
+					KnownBlocks.Add(Block);
+				}
+				else if (!KnownBlocks.Contains(Block))
+				{
+					++NumNewBlocks;
+				}
+			}
+			TestTrue(TEXT("Duplicate keeps the inline damage type"),
+				static_cast<const FAuraGameplayEffectContext*>(Duplicate.Get())->GetDamageType() == DamageType);
+		}
+		Handles.Reset();
+	}
+
+	TestEqual(TEXT("Contexts allocated after the first frame that did not come from the pool"), NumNewBlocks, 0);
+	return true;
+}
+
+namespace AuraEffectContextTests
+{
+	// 写出 Context，再读回到 OutContext，返回线上位数
+	int64 RoundTrip(FAuraGameplayEffectContext& Context, FAuraGameplayEffectContext& OutContext)
+	{
+		FBitWriter Writer(0, true);
+		bool bSuccess = false;
+		Context.NetSerialize(Writer, nullptr, bSuccess);
+
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		OutContext.NetSerialize(Reader, nullptr, bSuccess);
+		return Writer.GetNumBits();
+	}
+}
+
+/**
+ * Context 量化 NetSerialize 的往返一致性与线上大小
+ *
+ * 功能说明：
+ * - 普通命中、Debuff 命中、径向伤害命中三种 Context 写出后读回，布尔标记与伤害类型必须一致；
+ * - 量化 float 的误差不超过半个量化步长（范围读自 UAuraAbilitySystemGlobals 的 Config），冲量/原点按 FVector_NetQuantize10 的 0.1 精度比较；
+ * - 超出量化范围的值走完整 float 回退，读回后与原值完全相同；
+ * - 表外伤害类型走完整 Tag 回退路径；读入一个空 Context 时，之前残留的扩展字段必须恢复默认值；
+ * - 每种 Context 的线上字节数以 AddInfo 输出。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectContextNetSerializeTest, "Aura.GAS.EffectContextNetSerialize",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraEffectContextNetSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraEffectContextTests;
+
+	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	constexpr float VectorTolerance = 0.1f;
+	// 量化范围与 NetSerialize 读取同一份 Config，位数来自 AuraEffectContextNetQuantize
+	const UAuraAbilitySystemGlobals* Globals = GetDefault<UAuraAbilitySystemGlobals>();
+	auto HalfStep = [](float MaxValue, uint32 NumBits) { return MaxValue / ((1u << NumBits) - 1) * 0.5f + KINDA_SMALL_NUMBER; };
+	const float DebuffDamageTolerance = HalfStep(Globals->EffectContextDebuffDamageMax, AuraEffectContextNetQuantize::DebuffDamageBits);
+	const float DebuffDurationTolerance = HalfStep(Globals->EffectContextDebuffDurationMax, AuraEffectContextNetQuantize::DebuffDurationBits);
+	const float DebuffFrequencyTolerance = HalfStep(Globals->EffectContextDebuffFrequencyMax, AuraEffectContextNetQuantize::DebuffFrequencyBits);
+	const float RadiusTolerance = HalfStep(Globals->EffectContextRadialDamageRadiusMax, AuraEffectContextNetQuantize::RadialDamageRadiusBits);
+
+	FAuraGameplayEffectContext HitContext;
+	HitContext.SetIsCriticalHit(true);
+	HitContext.SetDamageType(GamePlayTags.Damage_Lightning);
+	HitContext.SetDeathImpulse(FVector(3000.f, 1200.f, 500.f));
+	HitContext.SetKnockBackForce(FVector(600.f, -240.f, 200.f));
+
+	FAuraGameplayEffectContext DebuffContext = HitContext;
+	DebuffContext.SetIsBlockedHit(true);
+	DebuffContext.SetIsSuccessfulDebuff(true);
+	DebuffContext.SetDebuffDamage(5.3f);
+	DebuffContext.SetDebuffDuration(4.75f);
+	DebuffContext.SetDebuffFrequency(0.6f);
+
+	FAuraGameplayEffectContext RadialContext = HitContext;
+	RadialContext.SetIsRadialDamage(true);
+	RadialContext.SetRadialDamageInnerRadius(50.f);
+	RadialContext.SetRadialDamageOuterRadius(312.3f);
+	RadialContext.SetRadialDamageOrigin(FVector(1520.3f, -840.7f, 92.15f));
+
+	struct FCase
+	{
+		const TCHAR* Name;
+		FAuraGameplayEffectContext* Context;
+	};
+	for (const FCase& Case : { FCase{ TEXT("Hit"), &HitContext }, FCase{ TEXT("Debuff"), &DebuffContext }, FCase{ TEXT("Radial"), &RadialContext } })
+	{
+		const FAuraGameplayEffectContext& In = *Case.Context;
+		FAuraGameplayEffectContext Out;
+		const int64 NumBits = RoundTrip(*Case.Context, Out);
+
+		TestTrue(FString::Printf(TEXT("%s: flags survive"), Case.Name),
+			Out.IsCriticalHit() == In.IsCriticalHit()
+			&& Out.IsBlockedHit() == In.IsBlockedHit()
+			&& Out.IsSuccessfulDebuff() == In.IsSuccessfulDebuff()
+			&& Out.IsRadialDamage() == In.IsRadialDamage());
+		TestTrue(FString::Printf(TEXT("%s: damage type survives"), Case.Name), Out.GetDamageType() == In.GetDamageType());
+		TestNearlyEqual(FString::Printf(TEXT("%s: debuff damage"), Case.Name), Out.GetDebuffDamage(), In.GetDebuffDamage(), DebuffDamageTolerance);
+		TestNearlyEqual(FString::Printf(TEXT("%s: debuff duration"), Case.Name), Out.GetDebuffDuration(), In.GetDebuffDuration(), DebuffDurationTolerance);
+		TestNearlyEqual(FString::Printf(TEXT("%s: debuff frequency"), Case.Name), Out.GetDebuffFrequency(), In.GetDebuffFrequency(), DebuffFrequencyTolerance);
+		TestNearlyEqual(FString::Printf(TEXT("%s: inner radius"), Case.Name), Out.GetRadialDamageInnerRadius(), In.GetRadialDamageInnerRadius(), RadiusTolerance);
+		TestNearlyEqual(FString::Printf(TEXT("%s: outer radius"), Case.Name), Out.GetRadialDamageOuterRadius(), In.GetRadialDamageOuterRadius(), RadiusTolerance);
+		TestTrue(FString::Printf(TEXT("%s: death impulse"), Case.Name), Out.GetDeathImpulse().Equals(In.GetDeathImpulse(), VectorTolerance));
+		TestTrue(FString::Printf(TEXT("%s: knockback force"), Case.Name), Out.GetKnockBackForce().Equals(In.GetKnockBackForce(), VectorTolerance));
+		TestTrue(FString::Printf(TEXT("%s: radial origin"), Case.Name), Out.GetRadialDamageOrigin().Equals(In.GetRadialDamageOrigin(), VectorTolerance));
+
+		AddInfo(FString::Printf(TEXT("%s context: %lld bits (%lld bytes) on the wire"), Case.Name, NumBits, (NumBits + 7) / 8));
+	}
+
+	// 超出量化范围：不截断，以完整 float 发送（每个越界字段写出时记录一条警告）
+	AddExpectedMessage(TEXT("is outside the quantized range"), EAutomationExpectedMessageFlags::Contains, 2, false);
+	FAuraGameplayEffectContext OutOfRangeContext = DebuffContext;
+	OutOfRangeContext.SetDebuffDamage(Globals->EffectContextDebuffDamageMax * 4.f + 0.37f);
+	OutOfRangeContext.SetDebuffDuration(Globals->EffectContextDebuffDurationMax + 10.123f);
+	FAuraGameplayEffectContext OutOfRangeOut;
+	RoundTrip(OutOfRangeContext, OutOfRangeOut);
+	TestEqual(TEXT("Out-of-range debuff damage is sent as a full float"), OutOfRangeOut.GetDebuffDamage(), OutOfRangeContext.GetDebuffDamage());
+	TestEqual(TEXT("Out-of-range debuff duration is sent as a full float"), OutOfRangeOut.GetDebuffDuration(), OutOfRangeContext.GetDebuffDuration());
+	TestNearlyEqual(TEXT("In-range field next to a full float stays quantized"), OutOfRangeOut.GetDebuffFrequency(), OutOfRangeContext.GetDebuffFrequency(), DebuffFrequencyTolerance);
+
+	// 表外伤害类型：稠密索引写全 1，回退为完整 Tag
+	FAuraGameplayEffectContext FallbackContext;
+	FallbackContext.SetDamageType(GamePlayTags.Abilities_Fire_FireBolt);
+	FAuraGameplayEffectContext FallbackOut;
+	RoundTrip(FallbackContext, FallbackOut);
+	TestTrue(TEXT("Damage type outside the dense table survives"), FallbackOut.GetDamageType() == GamePlayTags.Abilities_Fire_FireBolt);
+
+	// 读入空 Context：目标上残留的扩展字段必须被清空
+	FAuraGameplayEffectContext EmptyContext;
+	FAuraGameplayEffectContext Reused = RadialContext;
+	Reused.SetDebuffDamage(9.f);
+	RoundTrip(EmptyContext, Reused);
+	TestTrue(TEXT("Reading an empty context resets Aura fields"),
+		!Reused.IsCriticalHit() && !Reused.IsRadialDamage() && !Reused.GetDamageType().IsValid()
+		&& Reused.GetDebuffDamage() == 0.f && Reused.GetRadialDamageOrigin().IsZero() && Reused.GetDeathImpulse().IsZero());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/DamageEvents.h"
+#include "GAS/AuraAbilitySystemLibrary.h"
+
+/**
+ * 径向衰减与引擎曲线的一致性
+ *
+ * 功能说明：
+ * - 期望值按 AActor::InternalTakeRadialDamage 的方式计算：Lerp(MinimumDamage, BaseDamage, FRadialDamageParams::GetDamageScale)；
+ * - 覆盖内半径内、衰减带内（线性与非线性指数）、外半径上与外半径外；
+ * - 外半径及以外引擎的 Overlap 不会命中目标，期望值为 0。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraRadialDamageFalloffTest, "Aura.GAS.RadialDamageFalloff",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraRadialDamageFalloffTest::RunTest(const FString& Parameters)
+{
+	const FVector Origin(100.f, -50.f, 20.f);
+	const FVector Direction = FVector(1.f, 2.f, 0.5f).GetSafeNormal();
+	const float BaseDamage = 80.f;
+	const float MinimumDamage = 10.f;
+	const float InnerRadius = 150.f;
+	const float OuterRadius = 600.f;
+
+	for (const float DamageFalloff : { 0.f, 1.f, 0.5f, 2.f })
+	{
+		const FRadialDamageParams Params(BaseDamage, MinimumDamage, InnerRadius, OuterRadius, DamageFalloff);
+		for (const float Distance : { 0.f, 75.f, InnerRadius, 200.f, 375.f, 599.f, OuterRadius, 900.f })
+		{
+			const FVector TargetLocation = Origin + Direction * Distance;
+			const float Actual = UAuraAbilitySystemLibrary::GetRadialDamageWithFalloff(
+				BaseDamage, MinimumDamage, Origin, InnerRadius, OuterRadius, DamageFalloff, TargetLocation);
+
+			const float DamageScale = Params.GetDamageScale(FVector::Dist(Origin, TargetLocation));
+			const float Expected = Distance >= OuterRadius ? 0.f : FMath::Lerp(MinimumDamage, BaseDamage, FMath::Max(0.f, DamageScale));
+
+			TestNearlyEqual(FString::Printf(TEXT("Falloff %.1f, distance %.1f"), DamageFalloff, Distance), Actual, Expected, 1.e-3f);
+		}
+	}
+
+	// 内半径大于外半径时引擎按内半径截断，这里同样视为满伤区
+	const FVector Inside = Origin + Direction * 250.f;
+	TestNearlyEqual(TEXT("Inner radius larger than outer radius"),
+		UAuraAbilitySystemLibrary::GetRadialDamageWithFalloff(BaseDamage, MinimumDamage, Origin, 300.f, 200.f, 1.f, Inside), BaseDamage, 1.e-3f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,297 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Abilities/GameplayAbility.h"
+#include "AuraGamePlayTags.h"
+#include "Game/AuraSaveGameFormat.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "Kismet/GameplayStatics.h"
+
+namespace AuraSaveGameTests
+{
+	// 构造一份存档：NumMaps 张地图，每张 NumActors 个 Actor 记录，每条记录带 BytesPerActor 字节的数据
+	ULoadScreenSaveGame* MakeSaveGame(int32 NumMaps, int32 NumActors, int32 BytesPerActor)
+	{
+		ULoadScreenSaveGame* SaveGame = NewObject<ULoadScreenSaveGame>();
+		for (int32 MapIndex = 0; MapIndex < NumMaps; ++MapIndex)
+		{
+			FSavedMap& SavedMap = SaveGame->FindOrAddSavedMap(FString::Printf(TEXT("/Game/Maps/Map_%d"), MapIndex));
+			for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+			{
+				FSavedActor& SavedActor = SavedMap.FindOrAddSavedActor(FName(TEXT("SaveableActor"), ActorIndex + 1));
+				SavedActor.Transform.SetLocation(FVector(ActorIndex, MapIndex, 0.f));
+				SavedActor.Bytes.Init(static_cast<uint8>(ActorIndex), BytesPerActor);
+			}
+		}
+		return SaveGame;
+	}
+
+	// 旧实现：LoadWorldState 对每个 Actor 按值取出整张地图，再逐条拷贝比较
+	const FSavedActor* FindSavedActorLegacy(const ULoadScreenSaveGame* SaveGame, const FString& MapName, const FName& ActorName, FSavedActor& OutCopy)
+	{
+		FSavedMap SavedMap;
+		for (const FSavedMap& Map : SaveGame->SavedMaps)
+		{
+			if (Map.MapAssetName == MapName)
+			{
+				SavedMap = Map;
+			}
+		}
+		for (FSavedActor SavedActor : SavedMap.SavedActors)
+		{
+			if (SavedActor.ActorName == ActorName)
+			{
+				OutCopy = SavedActor;
+				return &OutCopy;
+			}
+		}
+		return nullptr;
+	}
+
+	// 填充存档对象的所有字段（元数据、进度、属性、技能、地图与 Actor 数据）
+	ULoadScreenSaveGame* MakePopulatedSaveGame()
+	{
+		const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+		ULoadScreenSaveGame* SaveGame = MakeSaveGame(3, 25, 32);
+		SaveGame->SlotName = TEXT("LoadSlot_1");
+		SaveGame->SlotIndex = 1;
+		SaveGame->PlayerName = TEXT("Tester");
+		SaveGame->MapName = TEXT("Dungeon");
+		SaveGame->MapAssetName = TEXT("/Game/Maps/Map_1");
+		SaveGame->PlayerStartTag = TEXT("DungeonStart");
+		SaveGame->SaveSlotStatus = Taken;
+		SaveGame->bFirstTimeLoadIn = false;
+		SaveGame->PlayerLevel = 12;
+		SaveGame->XP = 3456;
+		SaveGame->SpellPoints = 3;
+		SaveGame->AttributePoints = 7;
+		SaveGame->Strength = 11.f;
+		SaveGame->Intelligence = 22.5f;
+		SaveGame->Resilience = 13.f;
+		SaveGame->Vigor = 9.25f;
+
+		FSavedAbility& SavedAbility = SaveGame->SavedAbilities.AddDefaulted_GetRef();
+		SavedAbility.GamePlayAbility = UGameplayAbility::StaticClass();
+		SavedAbility.AbilityTag = GamePlayTags.Abilities_Fire_FireBolt;
+		SavedAbility.AbilityStatus = GamePlayTags.Abilities_Status_Equipped;
+		SavedAbility.AbilitySlot = GamePlayTags.InputTag_LMB;
+		SavedAbility.AbilityType = GamePlayTags.Abilities_Type_Offensive;
+		SavedAbility.AbilityLevel = 4;
+		return SaveGame;
+	}
+
+	// 逐字段比较两个存档对象
+	void TestSaveGamesEqual(FAutomationTestBase& Test, const FString& What, const ULoadScreenSaveGame* Expected, const ULoadScreenSaveGame* Actual)
+	{
+		if (!Test.TestNotNull(What + TEXT(": loaded"), Actual)) return;
+
+		Test.TestEqual(What + TEXT(": SlotName"), Actual->SlotName, Expected->SlotName);
+		Test.TestEqual(What + TEXT(": SlotIndex"), Actual->SlotIndex, Expected->SlotIndex);
+		Test.TestEqual(What + TEXT(": PlayerName"), Actual->PlayerName, Expected->PlayerName);
+		Test.TestEqual(What + TEXT(": MapName"), Actual->MapName, Expected->MapName);
+		Test.TestEqual(What + TEXT(": MapAssetName"), Actual->MapAssetName, Expected->MapAssetName);
+		Test.TestTrue(What + TEXT(": PlayerStartTag"), Actual->PlayerStartTag == Expected->PlayerStartTag);
+		Test.TestEqual(What + TEXT(": SaveSlotStatus"), static_cast<int32>(Actual->SaveSlotStatus), static_cast<int32>(Expected->SaveSlotStatus));
+		Test.TestTrue(What + TEXT(": bFirstTimeLoadIn"), Actual->bFirstTimeLoadIn == Expected->bFirstTimeLoadIn);
+		Test.TestEqual(What + TEXT(": PlayerLevel"), Actual->PlayerLevel, Expected->PlayerLevel);
+		Test.TestEqual(What + TEXT(": XP"), Actual->XP, Expected->XP);
+		Test.TestEqual(What + TEXT(": SpellPoints"), Actual->SpellPoints, Expected->SpellPoints);
+		Test.TestEqual(What + TEXT(": AttributePoints"), Actual->AttributePoints, Expected->AttributePoints);
+		Test.TestEqual(What + TEXT(": Strength"), Actual->Strength, Expected->Strength);
+		Test.TestEqual(What + TEXT(": Intelligence"), Actual->Intelligence, Expected->Intelligence);
+		Test.TestEqual(What + TEXT(": Resilience"), Actual->Resilience, Expected->Resilience);
+		Test.TestEqual(What + TEXT(": Vigor"), Actual->Vigor, Expected->Vigor);
+
+		if (Test.TestEqual(What + TEXT(": SavedAbilities"), Actual->SavedAbilities.Num(), Expected->SavedAbilities.Num()))
+		{
+			for (int32 Index = 0; Index < Expected->SavedAbilities.Num(); ++Index)
+			{
+				const FSavedAbility& ExpectedAbility = Expected->SavedAbilities[Index];
+				const FSavedAbility& ActualAbility = Actual->SavedAbilities[Index];
+				Test.TestTrue(What + TEXT(": GamePlayAbility"), ActualAbility.GamePlayAbility == ExpectedAbility.GamePlayAbility);
+				Test.TestTrue(What + TEXT(": AbilityTag"), ActualAbility.AbilityTag == ExpectedAbility.AbilityTag);
+				Test.TestTrue(What + TEXT(": AbilityStatus"), ActualAbility.AbilityStatus == ExpectedAbility.AbilityStatus);
+				Test.TestTrue(What + TEXT(": AbilitySlot"), ActualAbility.AbilitySlot == ExpectedAbility.AbilitySlot);
+				Test.TestTrue(What + TEXT(": AbilityType"), ActualAbility.AbilityType == ExpectedAbility.AbilityType);
+				Test.TestEqual(What + TEXT(": AbilityLevel"), ActualAbility.AbilityLevel, ExpectedAbility.AbilityLevel);
+			}
+		}
+
+		if (!Test.TestEqual(What + TEXT(": SavedMaps"), Actual->SavedMaps.Num(), Expected->SavedMaps.Num())) return;
+		for (const FSavedMap& ExpectedMap : Expected->SavedMaps)
+		{
+			const FSavedMap* ActualMap = Actual->FindSavedMap(ExpectedMap.MapAssetName);
+			if (!Test.TestNotNull(What + TEXT(": map ") + ExpectedMap.MapAssetName, ActualMap)) continue;
+
+			Test.TestEqual(What + TEXT(": SavedActors"), ActualMap->SavedActors.Num(), ExpectedMap.SavedActors.Num());
+			for (const FSavedActor& ExpectedActor : ExpectedMap.SavedActors)
+			{
+				const FSavedActor* ActualActor = ActualMap->FindSavedActor(ExpectedActor.ActorName);
+				if (!Test.TestNotNull(What + TEXT(": actor ") + ExpectedActor.ActorName.ToString(), ActualActor)) continue;
+
+				Test.TestTrue(What + TEXT(": Transform"), ActualActor->Transform.Equals(ExpectedActor.Transform));
+				Test.TestTrue(What + TEXT(": Bytes"), ActualActor->Bytes == ExpectedActor.Bytes);
+			}
+		}
+	}
+}
+
+/**
+ * 按名称索引的存档查找：正确性
+ *
+ * 功能说明：
+ * - FindOrAdd 对同名记录只保留一条；
+ * - 反序列化等直接改写数组的情况下（数量变化），索引在下次查询时重建；
+ * - ResetSavedActors 之后旧名称查不到。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSavedActorIndexTest, "Aura.Game.SaveGame.SavedActorIndex",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSavedActorIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraSaveGameTests;
+
+	ULoadScreenSaveGame* SaveGame = MakeSaveGame(3, 10, 4);
+	TestEqual(TEXT("Map count"), SaveGame->SavedMaps.Num(), 3);
+
+	FSavedMap& SavedMap = SaveGame->FindOrAddSavedMap(TEXT("/Game/Maps/Map_1"));
+	TestEqual(TEXT("FindOrAddSavedMap returns the existing map"), SaveGame->SavedMaps.Num(), 3);
+	SavedMap.FindOrAddSavedActor(FName(TEXT("SaveableActor"), 5));
+	TestEqual(TEXT("FindOrAddSavedActor returns the existing actor"), SavedMap.SavedActors.Num(), 10);
+
+	const FSavedActor* SavedActor = SavedMap.FindSavedActor(FName(TEXT("SaveableActor"), 5));
+	if (TestNotNull(TEXT("Saved actor found"), SavedActor))
+	{
+		TestEqual(TEXT("Found the right record"), SavedActor->Transform.GetLocation().X, 4.0);
+	}
+
+	// 模拟反序列化直接追加到数组
+	FSavedActor Appended;
+	Appended.ActorName = TEXT("AppendedActor");
+	SavedMap.SavedActors.Add(Appended);
+	TestNotNull(TEXT("Index rebuilt after direct array change"), SavedMap.FindSavedActor(TEXT("AppendedActor")));
+
+	SavedMap.ResetSavedActors();
+	TestNull(TEXT("Reset clears lookups"), SavedMap.FindSavedActor(FName(TEXT("SaveableActor"), 5)));
+	TestNull(TEXT("Unknown map"), SaveGame->FindSavedMap(TEXT("/Game/Maps/Missing")));
+	return true;
+}
+
+/**
+ * 地图加载查找的性能对比（500 个已保存 Actor）
+ *
+ * 功能说明：
+ * - 模拟 LoadWorldState 的查找部分：20 张已访问地图，当前地图 500 个 Actor 记录（每条 256 字节数据），为每个 Actor 查找其记录；
+ * - 旧实现每个 Actor 都按值拷贝整张地图并逐条拷贝比较（O(Actor × 记录) 且深拷贝），新实现先取地图指针再按名称哈希查找；
+ * - 两种实现找到的记录必须一致，耗时以 AddInfo 输出。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSavedActorLookupBenchmark, "Aura.Game.SaveGame.LoadLookupBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAuraSavedActorLookupBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraSaveGameTests;
+
+	constexpr int32 NumMaps = 20;
+	constexpr int32 NumActors = 500;
+	const ULoadScreenSaveGame* SaveGame = MakeSaveGame(NumMaps, NumActors, 256);
+	const FString WorldName = FString::Printf(TEXT("/Game/Maps/Map_%d"), NumMaps / 2);
+
+	TArray<FName> ActorNames;
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+	{
+		ActorNames.Add(FName(TEXT("SaveableActor"), ActorIndex + 1));
+	}
+
+	int32 NumLegacyFound = 0;
+	int64 LegacyChecksum = 0;
+	const double LegacyStart = FPlatformTime::Seconds();
+	for (const FName& ActorName : ActorNames)
+	{
+		FSavedActor Copy;
+		if (const FSavedActor* SavedActor = FindSavedActorLegacy(SaveGame, WorldName, ActorName, Copy))
+		{
+			++NumLegacyFound;
+			LegacyChecksum += SavedActor->Bytes[0];
+		}
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+	int32 NumIndexedFound = 0;
+	int64 IndexedChecksum = 0;
+	const double IndexedStart = FPlatformTime::Seconds();
+	if (const FSavedMap* SavedMap = SaveGame->FindSavedMap(WorldName))
+	{
+		for (const FName& ActorName : ActorNames)
+		{
+			if (const FSavedActor* SavedActor = SavedMap->FindSavedActor(ActorName))
+			{
+				++NumIndexedFound;
+				IndexedChecksum += SavedActor->Bytes[0];
+			}
+		}
+	}
+	const double IndexedSeconds = FPlatformTime::Seconds() - IndexedStart;
+
+	TestEqual(TEXT("Legacy lookup finds every actor"), NumLegacyFound, NumActors);
+	TestEqual(TEXT("Indexed lookup finds every actor"), NumIndexedFound, NumActors);
+	TestEqual(TEXT("Both lookups return the same records"), IndexedChecksum, LegacyChecksum);
+
+	AddInfo(FString::Printf(TEXT("%d saved actors: legacy %.3f ms, indexed %.3f ms (%.1fx)"),
+		NumActors,
+		LegacySeconds * 1000.0,
+		IndexedSeconds * 1000.0,
+		IndexedSeconds > 0.0 ? LegacySeconds / IndexedSeconds : 0.0));
+	return true;
+}
+
+/**
+ * 存档格式往返：保存到内存再读取，所有字段必须一致
+ *
+ * 功能说明：
+ * - 本格式写出的数据以 "AURS" 开头，读取后逐字段与原对象比较；
+ * - 旧格式（引擎 SaveGameToMemory 写出的数据）同样可以读取（迁移路径）；
+ * - 损坏的数据（校验不一致、文件头中的原始大小异常）返回 nullptr，而不是默认对象或超大分配。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSaveGameFormatRoundTripTest, "Aura.Game.SaveGame.FormatRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSaveGameFormatRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraSaveGameTests;
+
+	const ULoadScreenSaveGame* SaveGame = MakePopulatedSaveGame();
+
+	TArray<uint8> Data;
+	if (!TestTrue(TEXT("SaveToMemory succeeds"), FAuraSaveGameFormat::SaveToMemory(const_cast<ULoadScreenSaveGame*>(SaveGame), Data))) return false;
+	TestTrue(TEXT("Written with the Aura header"), Data.Num() > 4 && FMemory::Memcmp(Data.GetData(), "AURS", 4) == 0);
+	TestSaveGamesEqual(*this, TEXT("Aura format"), SaveGame, Cast<ULoadScreenSaveGame>(FAuraSaveGameFormat::LoadFromMemory(Data)));
+
+	TArray<uint8> LegacyData;
+	TestTrue(TEXT("Legacy SaveGameToMemory succeeds"), UGameplayStatics::SaveGameToMemory(const_cast<ULoadScreenSaveGame*>(SaveGame), LegacyData));
+	TestSaveGamesEqual(*this, TEXT("Legacy migration"), SaveGame, Cast<ULoadScreenSaveGame>(FAuraSaveGameFormat::LoadFromMemory(LegacyData)));
+
+	// 文件头布局：Magic(4) 格式版本(4) 压缩算法(1) 原始大小(4) CRC32(4)
+	constexpr int32 UncompressedSizeOffset = sizeof(uint32) * 2 + sizeof(uint8);
+	constexpr int32 PayloadCrcOffset = UncompressedSizeOffset + sizeof(int32);
+
+	// 校验值与负载不一致（只改文件头，负载本身仍可正常解压）
+	TArray<uint8> Corrupted = Data;
+	Corrupted[PayloadCrcOffset] ^= 0xFF;
+	AddExpectedError(TEXT("checksum mismatch"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestNull(TEXT("Corrupted payload is rejected"), FAuraSaveGameFormat::LoadFromMemory(Corrupted));
+
+	// 原始大小被改成极大值：分配前拒绝
+	TArray<uint8> HugeSize = Data;
+	const int32 HugeUncompressedSize = MAX_int32;
+	FMemory::Memcpy(HugeSize.GetData() + UncompressedSizeOffset, &HugeUncompressedSize, sizeof(HugeUncompressedSize));
+	AddExpectedError(TEXT("too large"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestNull(TEXT("Oversized payload is rejected"), FAuraSaveGameFormat::LoadFromMemory(HugeSize));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -25,12 +25,12 @@ public:
 	/**
 	 * @brief 定义了这个生成点将要生成的敌人种类。
 	 *
-	 * TSubclassOf 是一种特殊的智能指针，它提供了一个下拉菜单，
-	 * 只能在蓝图编辑器中选择 AEnemyCharacter 或其任何子类，
-	 * 这可以防止设计师错误地选择一个非敌人的 Actor 类型。
+	 * 使用软引用：关卡加载时不会连带加载敌人类及其资源，
+	 * 由所属的刷怪区域在玩家接近时异步预加载（见 AAuraEnemySpawnVolume）。
+	 * 只能在编辑器中选择 AEnemyCharacter 或其任何子类。
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Class")
-	TSubclassOf<AEnemyCharacter> EnemyClass;
+	TSoftClassPtr<AEnemyCharacter> EnemyClass;
 
 	/**
 	 * @brief 将要生成的敌人的等级。
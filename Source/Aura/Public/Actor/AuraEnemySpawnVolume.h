@@ -4,11 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Engine/StreamableManager.h"
 #include "Interation/SaveInterface.h"
 #include "AuraEnemySpawnVolume.generated.h"
 
 class AAuraEnemySpawnPoint;
 class UBoxComponent;
+class USphereComponent;
 
 UCLASS()
 class AURA_API AAuraEnemySpawnVolume : public AActor, public ISaveInterface
@@ -23,22 +25,45 @@ public:
 	virtual void LoadActor_Implementation() override;
 	/*End Save Interface*/
 
+	//注册到可保存 Actor 注册表
+	virtual void PostInitializeComponents() override;
+
 	UPROPERTY(BlueprintReadOnly, SaveGame)
 	bool bReached = false;
 
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION()
 	virtual void OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
 	UPROPERTY(EditAnywhere)
 	TArray<AAuraEnemySpawnPoint*> SpawnPoints;
+
+	//玩家进入此半径时开始异步预加载生成点引用的敌人类
+	UPROPERTY(EditAnywhere, Category = "Enemy Preload", meta = (ClampMin = "0"))
+	float PrefetchRadius = 3000.f;
+
+	UFUNCTION()
+	virtual void OnPrefetchSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	//开始预加载（重复调用会被忽略）
+	void StartPrefetch();
+	//把所有生成点加入分帧生成队列
+	void QueueSpawns(const FVector& PlayerLocation);
 	
 private:
 
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<UBoxComponent> Box;
 
+	//预加载触发范围
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<USphereComponent> PrefetchSphere;
+
+	//预加载句柄（持有期间敌人类保持常驻）
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+
 };
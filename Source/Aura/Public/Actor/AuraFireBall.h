@@ -29,7 +29,8 @@ public:
 protected:
 
 	
-	virtual void BeginPlay() override;
+	virtual void OnProjectileActivated() override;
+	virtual void OnProjectileDeactivated() override;
 	virtual void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
 	virtual void OnHit() override;
 
@@ -10,7 +10,7 @@
 
 
 class UNiagaraSystem;
-class UProjectileMovementComponent;
+class UAuraProjectileMovementComponent;
 class USphereComponent;
 
 UCLASS()
@@ -23,7 +23,7 @@ public:
 	// 可见的投射物运动组件，用于控制投射物的移动逻辑
 	// VisibleAnywhere：表示该属性可见，但在编辑器中不可编辑
 	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UProjectileMovementComponent>  ProjectileMovement;
+	TObjectPtr<UAuraProjectileMovementComponent>  ProjectileMovement;
 
 	// 蓝图可读写的属性，用于传递投射物的伤害效果
 	// BlueprintReadWrite：表示该属性在蓝图中可读写
@@ -34,15 +34,23 @@ public:
 	UPROPERTY(VisibleAnywhere,BlueprintReadOnly)
 	TObjectPtr<USphereComponent> Sphere;
 
-	//归位目标的场景组件
-	UPROPERTY()
-	TObjectPtr<USceneComponent> HomingTargetSceneComponent;
+	//结束投射物：由对象池管理时停用回收，否则 Destroy（仅服务器）
+	UFUNCTION(BlueprintCallable)
+	void ReturnToPool();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 protected:
 	virtual void BeginPlay() override;
 	UFUNCTION(BlueprintCallable)
 	virtual void OnHit();
 	virtual void Destroyed() override;
+	virtual void LifeSpanExpired() override;
+
+	//进入激活状态（新生成的 BeginPlay / 从对象池取出 / 客户端收到激活）：显示、碰撞、移动、循环音效、寿命
+	virtual void OnProjectileActivated();
+	//进入停用状态（回收到对象池 / 客户端收到停用）：隐藏、停止移动与音效，并重置本次发射的参数
+	virtual void OnProjectileDeactivated();
 	bool IsValidOverlap(AActor* OtherActor);
 	UFUNCTION()
 	virtual void OnSphereOverlap(UPrimitiveComponent * OverlappedComponent, AActor * OtherActor, UPrimitiveComponent * OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult);
@@ -54,10 +62,30 @@ protected:
 	TObjectPtr<UAudioComponent> LoopingSoundComponent;
 
 private:
+	friend class UAuraProjectilePool;
+
 	//生命周期
 	UPROPERTY(EditDefaultsOnly)
 	float LifeSpan = 15.f;
 
+	//是否由对象池管理（服务器）
+	bool bPooled = false;
+	//对象池中的激活状态：复制到客户端，客户端据此切换显示/碰撞/音效
+	UPROPERTY(ReplicatedUsing=OnRep_PoolActive)
+	bool bPoolActive = true;
+	//本地是否已处于激活状态（保证激活/停用只执行一次）
+	bool bLocallyActive = false;
+
+	UFUNCTION()
+	void OnRep_PoolActive();
+	//本地切换激活状态
+	void SetLocallyActive(bool bActive);
+
+	//对象池接口
+	void InitPooled(bool bStartActive);
+	void ActivateFromPool(const FTransform& SpawnTransform);
+	void DeactivateForPool();
+
 
 
 	
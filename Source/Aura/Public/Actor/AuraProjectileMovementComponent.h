@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "AuraProjectileMovementComponent.generated.h"
+
+/**
+ * 投射物移动组件：在引擎的组件跟踪之外，支持直接跟踪一个世界坐标
+ *
+ * 功能说明：
+ * - 没有锁定目标时（例如朝鼠标点发射），不再为每发投射物创建一个 USceneComponent 作为跟踪点，
+ *   而是记录目标坐标，按与引擎 ComputeHomingAcceleration 相同的方式计算跟踪加速度；
+ * - HomingTargetComponent 有效时优先跟踪组件，行为与父类一致。
+ */
+UCLASS()
+class AURA_API UAuraProjectileMovementComponent : public UProjectileMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	//设置跟踪的世界坐标（同时清除跟踪组件）
+	void SetHomingTargetLocation(const FVector& InTargetLocation);
+	//清除跟踪目标（组件与坐标）
+	void ClearHomingTarget();
+
+protected:
+	virtual FVector ComputeAcceleration(const FVector& InVelocity, float DeltaTime) const override;
+
+private:
+	FVector HomingTargetLocation = FVector::ZeroVector;
+	bool bHasHomingTargetLocation = false;
+};
@@ -94,6 +94,22 @@ struct FDamageEffectParams
 	UPROPERTY(BlueprintReadWrite)
 	FVector KnockBackForce = FVector::ZeroVector;
 
+	//是否覆写击退方向（覆写时批量伤害直接使用 KnockBackForce，不再逐目标重算方向）
+	UPROPERTY(BlueprintReadWrite)
+	bool bOverrideKnockbackDirection = false;
+
+	//是否覆写死亡冲击方向（覆写时批量伤害直接使用 DeathImpulse）
+	UPROPERTY(BlueprintReadWrite)
+	bool bOverrideDeathImpulse = false;
+
+	//是否覆盖冲击/击退方向的俯仰角（批量伤害逐目标重算方向后再应用）
+	UPROPERTY(BlueprintReadWrite)
+	bool bOverridePitch = false;
+
+	//覆盖用的俯仰角（度）
+	UPROPERTY(BlueprintReadWrite)
+	float PitchOverride = 0.f;
+
 	//径向损伤
 	UPROPERTY(BlueprintReadWrite)
 	bool bIsRadialDamage = false;
@@ -119,7 +135,20 @@ struct FDamageEffectParams
 
 
 
-
+/**
+ * Effect Context 网络量化的位数
+ *
+ * 注意事项：
+ * - 各字段的范围上限 [0, Max] 由 UAuraAbilitySystemGlobals 的 Config 提供（服务器与客户端必须一致）；
+ * - 超出范围的值额外用 1 位标记，并以完整 float 发送。
+ */
+namespace AuraEffectContextNetQuantize
+{
+	constexpr uint32 DebuffDamageBits = 16;
+	constexpr uint32 DebuffDurationBits = 12;
+	constexpr uint32 DebuffFrequencyBits = 10;
+	constexpr uint32 RadialDamageRadiusBits = 14;
+}
 
 USTRUCT(BlueprintType)
 struct FAuraGameplayEffectContext : public FGameplayEffectContext
@@ -133,7 +162,7 @@ public:
 	float GetDebuffDamage() const {return DebuffDamage;}
 	float GetDebuffDuration() const {return DebuffDuration;}
 	float GetDebuffFrequency() const {return DebuffFrequency;}
-	TSharedPtr<FGameplayTag> GetDamageType() const {return DamageType;}
+	const FGameplayTag& GetDamageType() const {return DamageType;}
 	FVector GetDeathImpulse() const {return DeathImpulse;}
 	FVector GetKnockBackForce() const {return KnockBackForce;}
 	bool IsRadialDamage() const { return bIsRadialDamage; }
@@ -147,7 +176,7 @@ public:
 	void SetDebuffDamage(float InDamage){DebuffDamage = InDamage;}
 	void SetDebuffDuration(float InDuration){DebuffDuration = InDuration;}
 	void SetDebuffFrequency(float InFrequency){DebuffFrequency = InFrequency;}
-	void SetDamageType(TSharedPtr<FGameplayTag> InDamageType){DamageType = InDamageType;}
+	void SetDamageType(const FGameplayTag& InDamageType){DamageType = InDamageType;}
 	void SetDeathImpulse(const FVector& InImpulse){DeathImpulse = InImpulse;}
 	void SetKnockBackForce(const FVector& InForce){KnockBackForce = InForce;}
 	void SetIsRadialDamage(bool bInIsRadialDamage){bIsRadialDamage = bInIsRadialDamage;}
@@ -168,6 +197,22 @@ public:
 	 */
 	virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
+	/*
+	 * 池化分配：Context 由 FGameplayEffectContextHandle 以 new/delete 管理，命中路径上每次施加都会分配一次。
+	 * 这里重载类级 operator new/delete，从无锁空闲链表复用固定大小的内存块；池空时才回退到 FMemory::Malloc。
+	 * 可用 "stat AuraEffectContext" 查看分配次数、池未命中次数与存活数量。
+	 * 注意：这里只覆盖 Context 本身。FGameplayEffectContextHandle 在引擎内部以 TSharedPtr 接管裸指针，
+	 * 其引用计数控制块仍从通用堆分配（每个 Handle 一次），引擎没有提供注入自定义删除器/分配器的入口。
+	 */
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr, size_t Size);
+	// 反射系统（UScriptStruct）使用定位 new 原地构造，类级 operator new 会隐藏全局版本，需显式提供
+	static void* operator new(size_t Size, void* Place) { return Place; }
+	static void operator delete(void* Ptr, void* Place) {}
+
+	// 预热内存池（例如在 InitGlobalData 时调用），保证首批命中也不触发通用堆分配
+	static void ReservePool(int32 NumContexts);
+
 
 	// 虚函数 Duplicate() 用于复制一个 FAuraGameplayEffectContext 对象
 	virtual FAuraGameplayEffectContext* Duplicate() const
@@ -209,8 +254,9 @@ protected:
 	//Debuff频率
 	UPROPERTY()
 	float DebuffFrequency = 0.f;
-	//伤害类型
-	TSharedPtr<FGameplayTag> DamageType;
+	//伤害类型（内联存放，避免每次命中额外的堆分配）
+	UPROPERTY()
+	FGameplayTag DamageType;
 	//死亡脉冲
 	UPROPERTY()
 	FVector DeathImpulse = FVector::ZeroVector;
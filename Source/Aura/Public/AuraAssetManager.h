@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "AuraAssetManager.generated.h"
 
 /**
@@ -17,6 +18,9 @@ class AURA_API UAuraAssetManager : public UAssetManager
 	public:
 	//获取资产管理器
 	static UAuraAssetManager& Get();
+
+	//异步预加载敌人类（及其引用的网格、动画蓝图、行为树、特效等依赖），返回的句柄在释放前保持资源常驻
+	TSharedPtr<FStreamableHandle> PreloadEnemyClasses(TArray<FSoftObjectPath> EnemyClassPaths);
 	private:
 	//开始初始加载
 	virtual void StartInitialLoading() override;
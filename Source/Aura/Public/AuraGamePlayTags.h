@@ -5,12 +5,41 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 
+/**
+ * 伤害类型稠密索引：与 FAuraGamePlayTags::DamageTypeInfos 的下标一一对应
+ * 伤害执行计算按下标遍历，避免逐次命中时的 TMap 构建与哈希查找
+ */
+namespace EAuraDamageTypeIndex
+{
+	enum Type : uint8
+	{
+		Fire,
+		Lightning,
+		Arcane,
+		Physical,
+		Num
+	};
+}
+
+/**
+ * 单个伤害类型的预编译信息（在 InitializeNativeGameplayTags 中一次性构建）
+ */
+struct FAuraDamageTypeInfo
+{
+	//伤害类型标签（同时也是 SetByCaller 的键）
+	FGameplayTag DamageType;
+	//对应抗性属性标签
+	FGameplayTag Resistance;
+	//对应 Debuff 标签
+	FGameplayTag Debuff;
+};
+
 /**
  * 单列模式 ：它确保一个类只有一个实例，并提供一个全局访问点来获取该实例
  * 包含原生玩法标签的单例
  */
 //结构体FAuraGamePlayTags, 用来存储与游戏标签相关数据
-struct FAuraGamePlayTags
+struct AURA_API FAuraGamePlayTags
 {
 public:
 	
@@ -74,6 +103,8 @@ public:
 	/*
 	 *	输入操作标签
 	 */
+	//输入标签父级（用于判断“是否属于输入/槽位标签”，避免热路径上的 RequestGameplayTag）
+	FGameplayTag InputTag;
 	//左键
 	FGameplayTag InputTag_LMB;
 	//右键
@@ -115,6 +146,12 @@ public:
 	//伤害类型减益数组
 	TMap<FGameplayTag,FGameplayTag> DamageTypesToDebuffs;
 
+	//伤害类型信息表（按 EAuraDamageTypeIndex 下标访问：伤害类型 / 抗性 / Debuff）
+	FAuraDamageTypeInfo DamageTypeInfos[EAuraDamageTypeIndex::Num];
+
+	//根据伤害类型标签获取稠密索引（未找到返回 INDEX_NONE）
+	int32 GetDamageTypeIndex(const FGameplayTag& DamageType) const;
+
 	/*
 	 * Debuff主要参数
 	 */
@@ -145,6 +182,8 @@ public:
 	FGameplayTag Abilities_Arcane_ArcaneShards;
 
 	
+	//技能标签父级
+	FGameplayTag Abilities;
 	FGameplayTag Abilities_None;
 	FGameplayTag Abilities_Attack;
 	FGameplayTag Abilities_Summon;
@@ -153,6 +192,8 @@ public:
 	/*
 	 * 技能状态
 	 */
+	//技能状态父级
+	FGameplayTag Abilities_Status;
 	FGameplayTag Abilities_Status_Locked;
 	FGameplayTag Abilities_Status_Eligible;
 	FGameplayTag Abilities_Status_Unlocked;
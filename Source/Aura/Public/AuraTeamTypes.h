@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AuraTeamTypes.generated.h"
+
+/**
+ * 阵营
+ *
+ * 注意事项：
+ * - None 表示未分配阵营（与所有阵营敌对，包括 None 自身），与旧的基于 Actor 标签判定时“没有标签即不是朋友”的结果一致；
+ * - 新增阵营时在 MAX 之前追加，并在 FAuraTeamRelations::HostileMasks 中补一行。
+ */
+UENUM(BlueprintType)
+enum class EAuraTeam : uint8
+{
+	None,
+	Player,
+	Enemy,
+
+	MAX UMETA(Hidden)
+};
+
+/**
+ * 阵营关系表
+ *
+ * 功能说明：
+ * - 每个阵营一行敌对位掩码（第 i 位为 1 表示与阵营 i 敌对），敌我判定只需一次查表加一次位与；
+ * - 表在编译期确定，不需要初始化，也不分配内存。
+ */
+struct FAuraTeamRelations
+{
+	static_assert(static_cast<uint8>(EAuraTeam::MAX) <= 8, "Team masks are stored in uint8");
+
+	static constexpr uint8 TeamBit(EAuraTeam Team) { return static_cast<uint8>(1u << static_cast<uint8>(Team)); }
+
+	//按 EAuraTeam 顺序排列的敌对掩码
+	static constexpr uint8 HostileMasks[static_cast<uint8>(EAuraTeam::MAX)] =
+	{
+		/* None   */ 0xFF,
+		/* Player */ TeamBit(EAuraTeam::None) | TeamBit(EAuraTeam::Enemy),
+		/* Enemy  */ TeamBit(EAuraTeam::None) | TeamBit(EAuraTeam::Player),
+	};
+
+	//两个阵营是否敌对
+	static FORCEINLINE bool AreHostile(EAuraTeam A, EAuraTeam B)
+	{
+		return (HostileMasks[static_cast<uint8>(A)] & TeamBit(B)) != 0;
+	}
+};
@@ -86,6 +86,8 @@ public:
 	virtual bool IsBeingShocked_Implementation() const override;
 
 	virtual FOnDamageSignature& GetOnDamageSignature() override;
+
+	virtual EAuraTeam GetTeam() const override { return Team; }
 	
 	/*Combatinterface接口结束*/
 
@@ -129,6 +131,8 @@ public:
 protected:
 	//游戏开始
 	virtual void BeginPlay() override;
+	//离开关卡/销毁：从存活单位注册表中注销
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	//初始化 能力Actor信息集
 	virtual void InitAbilityActorInfo();
@@ -186,6 +190,15 @@ protected:
 
 	void Dissolve();
 
+	//撤销 MulticastHandleDeath 的表现（布娃娃、掉落的武器、溶解材质、胶囊体碰撞），供回收复用的角色重新上场
+	virtual void ResetDeathState();
+
+	//BeginPlay 时记录的原始材质，溶解材质替换后用于还原
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInterface> DefaultMeshMaterial;
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInterface> DefaultWeaponMaterial;
+
 	//BlueprintImplementableEvent：声明一个函数，C++ 不提供实现，逻辑完全由蓝图来定义。
 	//溶解时间轴事件
 	UFUNCTION(BlueprintImplementableEvent)
@@ -219,6 +232,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Character Class Defaults")
 	ECharacterClass CharacterClass = ECharacterClass::Warrior;
 
+	//阵营（玩家/敌人在各自构造函数中设置默认值）
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Combat")
+	EAuraTeam Team = EAuraTeam::None;
+
 	//燃烧减益组件
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<UDebuffNiagaraComponent> BurnDebuffComponent;
@@ -60,8 +60,12 @@ public:
 	float LifeSpan = 5.f;
 
 	void SetLevel(int32 InLevel) {Level = InLevel;}
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 protected:
 	virtual void BeginPlay() override;
+	//寿命到期：由回收池管理的敌人回到池中，其余照常销毁
+	virtual void LifeSpanExpired() override;
 	//初始化 能力Actor信息集
 	virtual void InitAbilityActorInfo() override;
 	
@@ -93,5 +97,29 @@ protected:
 
 	UFUNCTION(BlueprintImplementableEvent)
 	void SpawnLoot();
-	
+
+private:
+	friend class UAuraEnemyPool;
+
+	//是否由 UAuraEnemyPool 管理（死亡后回收而不是销毁）
+	bool bPooled = false;
+
+	//是否处于激活状态（复制到客户端，用于切换隐藏/恢复死亡表现）
+	UPROPERTY(ReplicatedUsing=OnRep_PoolActive)
+	bool bPoolActive = true;
+
+	UFUNCTION()
+	void OnRep_PoolActive();
+
+	//标记为池管理实例（在 FinishSpawning 之前调用）
+	void InitPooled() { bPooled = true; }
+
+	//以新的等级/职业重新上场（服务器）
+	void ActivateFromPool(const FTransform& SpawnTransform, int32 InLevel, ECharacterClass InCharacterClass);
+
+	//停用：停止 AI、清空技能与效果并隐藏（服务器）
+	void DeactivateForPool();
+
+	//本地切换停用时的隐藏/碰撞/物理状态
+	void SetPoolHidden(bool bPoolHidden);
 };
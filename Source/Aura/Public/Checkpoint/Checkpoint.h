@@ -27,16 +27,23 @@ public:
 	virtual void LoadActor_Implementation() override;
 	/* End Save Interface*/
 
+	//注册到可保存 Actor 注册表
+	virtual void PostInitializeComponents() override;
+
 	/* Start HighlightInterface*/
 	virtual void HighlightActor_Implementation() override;
 	virtual void UnHighlightActor_Implementation() override;
 	virtual void SetMoveToLocation_Implementation(FVector& OutDestination) override;
 	/* End HighlightInterface*/
 
-	//是否已到达
-	UPROPERTY(BlueprintReadWrite, SaveGame)
+	//是否已到达（蓝图中的“设置”节点经 SetReached 写入，保证增量存档能感知修改）
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetReached, SaveGame)
 	bool bReached = false;
 
+	//设置是否已到达：值变化时调用 MarkSaveDirty，下次 SaveWorldState 会重新序列化本 Actor
+	UFUNCTION(BlueprintSetter)
+	void SetReached(bool bInReached);
+
 	//是否绑定重叠回调
 	UPROPERTY(EditAnywhere)
 	bool bBindOverlapCallback = true;
@@ -45,6 +52,7 @@ protected:
 	virtual void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	//已到达检查点
 	UFUNCTION(BlueprintImplementableEvent)
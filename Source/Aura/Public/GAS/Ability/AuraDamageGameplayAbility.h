@@ -21,6 +21,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void CauseDamage(AActor* TargetActor);
 
+	//对多个目标造成伤害（同一次施法只构建一次伤害 Spec，逐目标分发）
+	UFUNCTION(BlueprintCallable)
+	void CauseDamageToTargets(const TArray<AActor*>& TargetActors, FVector InRadialDamageOrigin = FVector::ZeroVector, bool bOverridePitch = false, float PitchOverride = 0.f);
+
 	//从类默认值创建伤害效果参数
 	UFUNCTION(BlueprintPure)
 	FDamageEffectParams MakeDamageEffectParamsFromClassDefaults(
@@ -34,6 +38,10 @@ public:
 		float PitchOverride = 0.0f
 		)const;
 
+	//为批量伤害创建参数（冲击/击退方向由 ApplyDamageEffectBatch 逐目标计算，Pitch 覆盖随参数携带）
+	UFUNCTION(BlueprintPure)
+	FDamageEffectParams MakeBatchDamageEffectParams(FVector InRadialDamageOrigin = FVector::ZeroVector, bool bOverridePitch = false, float PitchOverride = 0.f) const;
+
 	//获取根据等级的上海数值
 	UFUNCTION(BlueprintPure)
 	float GetDamageAtLevel() const;
@@ -20,6 +20,9 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	TArray<AAuraFireBall*> SpawnFireBalls();
+
+	//授予技能时预热火球对象池
+	virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
 protected:
 	UPROPERTY(BlueprintReadOnly,EditDefaultsOnly, Category="FireBlast")
 	int32 NumFireBalls = 12;
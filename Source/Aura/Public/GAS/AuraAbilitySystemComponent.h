@@ -124,9 +124,13 @@ public:
 	void ClearAbilitiesOfSlot(const FGameplayTag& Slot);
 	//判断能力是否有槽位
 	static bool AbilityHasSlot(FGameplayAbilitySpec* Spec, const FGameplayTag& Slot);
+	//使技能规格索引失效（修改了规格的技能标签/槽位/状态后调用）
+	void MarkAbilitySpecIndexDirty();
 protected:
 
 	virtual void OnRep_ActivateAbilities() override;
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
 
 	
 	//应用的效果
@@ -138,4 +142,34 @@ protected:
 	//RPC:客户端更新能力状态
 	UFUNCTION(Client,Reliable)
 	void ClientUpdateAbilityStatus(const FGameplayTag& AbilityTag , const FGameplayTag& StatusTag , int32 AbilityLevel);
+
+private:
+	/*
+	 * 技能规格二级索引：把按标签的线性扫描变为哈希查找（含输入分发表）
+	 * 值为 ActivatableAbilities.Items 的下标；ItemHandles 与 Items 一一对应，用于校验下标是否仍然有效
+	 */
+	struct FAbilitySpecIndex
+	{
+		//技能标签 → 规格下标
+		TMap<FGameplayTag, int32> AbilityTagToItem;
+		//槽位（输入标签） → 规格下标
+		TMap<FGameplayTag, int32> SlotToItem;
+		//输入分发表：输入标签 → 绑定该输入的全部规格下标
+		TMap<FGameplayTag, TArray<int32, TInlineAllocator<2>>> InputTagToItems;
+		//下标 → 规格句柄
+		TArray<FGameplayAbilitySpecHandle> ItemHandles;
+		//下标 → 状态标签
+		TArray<FGameplayTag> ItemStatuses;
+	};
+	FAbilitySpecIndex AbilitySpecIndex;
+	bool bAbilitySpecIndexDirty = true;
+
+	//索引失效时重建
+	void RebuildAbilitySpecIndexIfNeeded();
+	//在索引表中查找规格并校验句柄
+	FGameplayAbilitySpec* FindIndexedSpec(const TMap<FGameplayTag, int32>& IndexMap, const FGameplayTag& Key);
+
+	using FInputTagSpecs = TArray<FGameplayAbilitySpec*, TInlineAllocator<4>>;
+	//输入分发：取出绑定了该输入标签的规格
+	void GatherSpecsForInputTag(const FGameplayTag& InputTag, FInputTagSpecs& OutSpecs);
 };
@@ -4,8 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemGlobals.h"
+#include "GameplayTagContainer.h"
 #include "AuraAbilitySystemGlobals.generated.h"
 
+class UGameplayEffect;
 /**
  * 
  */
@@ -15,5 +17,30 @@ class AURA_API UAuraAbilitySystemGlobals : public UAbilitySystemGlobals
 	GENERATED_BODY()
 
 	virtual FGameplayEffectContext* AllocGameplayEffectContext() const override;
-	
+
+public:
+	virtual void InitGlobalData() override;
+
+	//获取（或创建并缓存）动态 Debuff GE 定义：按（伤害类型, 持续时间, 频率）复用，每跳伤害通过 SetByCaller 传入
+	UGameplayEffect* FindOrCreateDebuffEffect(const FGameplayTag& DamageType, float DebuffDuration, float DebuffFrequency);
+
+	//启动时预分配的 Effect Context 数量（覆盖单帧峰值命中数即可）
+	UPROPERTY(Config)
+	int32 NumPreallocatedEffectContexts = 1024;
+
+	//Effect Context 网络量化范围上限：[0, Max] 映射到 AuraEffectContextNetQuantize 中的固定位数，超出范围的值以完整 float 发送
+	//服务器与客户端都在 NetSerialize 时读取同一份 Config，修改时两端必须一致
+	UPROPERTY(Config)
+	float EffectContextDebuffDamageMax = 2048.f;		// 16 位，精度约 0.03
+	UPROPERTY(Config)
+	float EffectContextDebuffDurationMax = 64.f;		// 12 位，精度约 0.016 秒
+	UPROPERTY(Config)
+	float EffectContextDebuffFrequencyMax = 16.f;		// 10 位，精度约 0.016 秒
+	UPROPERTY(Config)
+	float EffectContextRadialDamageRadiusMax = 8192.f;	// 14 位，精度约 0.5 厘米
+
+private:
+	//Debuff GE 缓存（键为 GE 名称，已包含伤害类型/持续时间/频率）
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UGameplayEffect>> DebuffEffectCache;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AuraAbilityTypes.h"
+#include "AuraTeamTypes.h"
 #include "GameplayEffectTypes.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GAS/Data/CharacterClassInfo.h"
@@ -164,11 +165,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static void GetLivePlayersWithinRadius(const UObject* WorldContextObject, TArray<AActor*>& OutOverlappingActors, const TArray<AActor*> &ActorsToIgnore, float Radius, const FVector& SphereLocation);
 
-	//判断是同一阵营
-	//获取半径内的玩家
+	//径向伤害衰减：按与原点的距离解析计算衰减后的伤害（与引擎 ApplyRadialDamageWithFalloff 的衰减曲线一致，不做物理查询）
+	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
+	static float GetRadialDamageWithFalloff(float BaseDamage, float MinimumDamage, const FVector& Origin, float InnerRadius, float OuterRadius, float DamageFalloff, const FVector& TargetLocation);
+
+	//判断不是同一阵营（敌对）
 	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static bool IsNotFriend(AActor* FirstActor,AActor* SecondActor);
 
+	//获取 Actor 的阵营（未实现 ICombatInterface 的 Actor 返回 None）
+	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
+	static EAuraTeam GetActorTeam(const AActor* Actor);
+
 	//获得职业和级别的 XP 奖励
 	static int32 GetXPRewardForClassAndLevel(const UObject* WorldContextObject,ECharacterClass CharacterClass,int32 CharacterLevel) ;
 
@@ -176,6 +184,13 @@ public:
 	UFUNCTION(BlueprintCallable,Category = "AuraAbilitySystemLibrary|DamageEffect")
 	static FGameplayEffectContextHandle ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams);
 
+	//批量应用伤害（AoE：同一次施法只构建一次来源侧数据，再逐目标分发）
+	static TArray<FGameplayEffectContextHandle> ApplyDamageEffectBatch(const FDamageEffectParams& DamageEffectParams, TArrayView<UAbilitySystemComponent*> TargetAbilitySystemComponents);
+
+	//批量应用伤害（蓝图版本，按目标 Actor 列表）
+	UFUNCTION(BlueprintCallable,Category = "AuraAbilitySystemLibrary|DamageEffect")
+	static void ApplyDamageEffectToActors(const FDamageEffectParams& DamageEffectParams, const TArray<AActor*>& TargetActors);
+
 	//均匀分布的旋转器
 	UFUNCTION(BlueprintPure,Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static TArray<FRotator> EvenlySpacedRotators(const FVector& Forward, const FVector& Axis, float Spread, int32 NumRotators);
@@ -191,6 +206,8 @@ public:
 	//获取最近的目标
 	UFUNCTION(BlueprintPure,Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static void GetClosestTargets(int32 MaxTargets, const TArray<AActor*>& Actors, TArray<AActor*>& OutClosestTargets, const FVector& Origin);
+	//获取最近的目标（无堆分配版本：结果写入内联数组，供持续施法技能每帧调用）
+	static void GetClosestTargets(int32 MaxTargets, TArrayView<AActor* const> Actors, TArray<AActor*, TInlineAllocator<8>>& OutClosestTargets, const FVector& Origin);
 
 	/*
 	 * 伤害参数
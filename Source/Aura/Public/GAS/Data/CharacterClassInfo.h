@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "ScalableFloat.h"
+#include "Curves/RealCurve.h"
 #include "CharacterClassInfo.generated.h"
 
 class UGameplayAbility;
@@ -36,6 +37,36 @@ struct FCharacterClassDefaultInfo
 	FScalableFloat XPReward = FScalableFloat();
 };
 
+/**
+ * 伤害计算系数缓存：把 DamageCalculationCoefficientes 中的曲线按等级烘焙成平铺数组
+ * 伤害执行时以 Coeffs.ArmorPen[Level] 形式直接下标读取，避免每次命中都做 FName 查找与曲线插值
+ */
+struct FDamageCalculationCoefficients
+{
+	struct FBakedCurve
+	{
+		//按等级（下标即等级）烘焙的曲线值
+		TArray<float> Values;
+		//原始曲线（超出烘焙范围时回退插值）
+		const FRealCurve* Curve = nullptr;
+
+		void Bake(const FRealCurve* InCurve);
+
+		float operator[](int32 Level) const
+		{
+			if (Values.IsValidIndex(Level)) return Values[Level];
+			return Curve ? Curve->Eval(Level) : 0.f;
+		}
+	};
+
+	//护甲穿透系数
+	FBakedCurve ArmorPen;
+	//有效护甲系数
+	FBakedCurve EffectiveArmor;
+	//暴击抗性系数
+	FBakedCurve CriticalHitResistance;
+};
+
 /**
  * 
  */
@@ -77,6 +108,27 @@ public:
 	// 声明函数：获取对应职业的默认信息
 	FCharacterClassDefaultInfo GetClassDefault(ECharacterClass CharacterClass);
 
-	
-	
+	//获取伤害计算系数缓存（首次访问或失效后重新烘焙）
+	const FDamageCalculationCoefficients& GetDamageCalculationCoefficients() const;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	//把系数曲线烘焙为按等级的平铺数组
+	void BakeDamageCalculationCoefficients() const;
+	//曲线表变更（重新导入/编辑）时使缓存失效
+	void InvalidateDamageCalculationCoefficients();
+
+	mutable FDamageCalculationCoefficients CachedCoefficients;
+	mutable bool bCoefficientsBaked = false;
+
+#if WITH_EDITOR
+	//监听曲线表重新导入
+	void BindCurveTableChanged();
+	TWeakObjectPtr<UCurveTable> BoundCurveTable;
+	FDelegateHandle CurveTableChangedHandle;
+#endif
 };
@@ -15,10 +15,9 @@ class AURA_API UExecCalc_Damage : public UGameplayEffectExecutionCalculation
 	GENERATED_BODY()
 public:
 	UExecCalc_Damage();
-	void DetermineDebuff(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
-	                     const FGameplayEffectSpec& Spec,
-	                     FAggregatorEvaluateParameters EvaluateParameters,
-	                    const TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition>& InTagsToDefs) const;
+	void DetermineDebuff(const FGameplayEffectSpec& Spec,
+	                     int32 DamageTypeIndex,
+	                     float TargetDebuffResistance) const;
 
 	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
 	
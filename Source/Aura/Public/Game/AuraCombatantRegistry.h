@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraCombatantRegistry.generated.h"
+
+/**
+ * 存活战斗单位注册表（世界子系统）
+ *
+ * 功能说明：
+ * - 维护实现了 ICombatInterface 的存活单位的均匀网格（XY 平面），替代基于物理 Overlap 的范围查找；
+ * - 角色在 BeginPlay 时注册、死亡或 EndPlay 时注销；
+ * - 位置按需刷新：每帧首次查询时把移动过的单位换到新格子（仅跨格时才搬移）。
+ *
+ * 提供的查询（均不触碰物理场景）：
+ * - 半径查询 GetCombatantsInRadius
+ * - 最近 K 个 GetClosestCombatants
+ * - 锥形查询 GetCombatantsInCone
+ */
+UCLASS()
+class AURA_API UAuraCombatantRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//便捷获取（世界不支持本子系统时返回 nullptr）
+	static UAuraCombatantRegistry* Get(const UObject* WorldContextObject);
+
+	//注册存活单位（重复注册会被忽略）
+	void RegisterCombatant(AActor* Combatant);
+	//注销单位（死亡 / EndPlay）
+	void UnregisterCombatant(AActor* Combatant);
+
+	//半径查询：单位碰撞半径与查询球相交即算在内（与胶囊体 Overlap 的结果一致）
+	void GetCombatantsInRadius(const FVector& Origin, float Radius, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore);
+
+	//最近 K 个：在 MaxRadius 内按与 Origin 的距离由近到远取最多 MaxCount 个
+	void GetClosestCombatants(const FVector& Origin, int32 MaxCount, float MaxRadius, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore);
+
+	//锥形查询：以 Origin 为顶点、沿 Direction、半角 HalfAngleDegrees、长度 Range 的锥体
+	void GetCombatantsInCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Range, TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore);
+
+	//已注册的单位数量
+	int32 GetNumCombatants() const { return Combatants.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	//单个注册单位
+	struct FCombatantEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		//ActorToIndex 中的键（Actor 销毁后仍可用于移除）
+		TObjectKey<AActor> ActorKey;
+		FVector Location = FVector::ZeroVector;
+		float CollisionRadius = 0.f;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	//网格格子边长（厘米）：与常见技能半径同一量级，半径查询通常只覆盖 3x3 个格子
+	static constexpr float CellSize = 500.f;
+
+	//单位表（稀疏数组：注销不移动其他元素，格子中保存的下标保持有效）
+	TSparseArray<FCombatantEntry> Combatants;
+	//Actor → 单位表下标
+	TMap<TObjectKey<AActor>, int32> ActorToIndex;
+	//格子 → 单位表下标
+	TMap<FIntPoint, TArray<int32>> Cells;
+	//所有单位中最大的碰撞半径（查询时用来扩展覆盖的格子范围）
+	float MaxCollisionRadius = 0.f;
+	//上次刷新位置的帧号
+	uint64 LastRefreshFrame = 0;
+
+	static FIntPoint GetCellForLocation(const FVector& Location);
+	//每帧首次查询时刷新位置并搬移跨格单位；同时清理已失效的单位
+	void RefreshIfStale();
+	void RefreshLocations();
+	void RemoveFromCell(int32 EntryIndex, const FIntPoint& Cell);
+	//遍历与包围盒相交的格子中的单位
+	template<typename FunctorType>
+	void ForEachCombatantInBounds(const FVector& Origin, float Radius, FunctorType&& Functor);
+};
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GAS/Data/CharacterClassInfo.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemyPool.generated.h"
+
+class AEnemyCharacter;
+
+//同一敌人类的空闲实例
+USTRUCT()
+struct FAuraEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemyCharacter>> FreeEnemies;
+};
+
+/**
+ * 敌人回收池（世界子系统，仅服务器使用）
+ *
+ * 功能说明：
+ * - 按敌人类分桶缓存已死亡的敌人；尸体溶解（LifeSpan 到期）后停用回收，而不是 Destroy；
+ * - 取用时复用原有的 ASC、属性集、血条、Niagara 组件和 AI 控制器：清空技能与效果后按新的等级/职业重新初始化属性，
+ *   把网格体从布娃娃状态恢复，再由保留下来的 AI 控制器重新 Possess（重新初始化黑板并运行行为树）；
+ * - 停用的敌人隐藏并关闭碰撞，客户端保留同一个 Actor，重新激活时通过 bPoolActive 的 OnRep 恢复表现。
+ *
+ * 注意事项：
+ * - 只有通过 AcquireEnemy 生成的敌人才会回收（召唤的仆从等仍走原来的销毁流程）；
+ * - 每类最多缓存 MaxPooledPerClass 个，超出部分直接销毁。
+ */
+UCLASS()
+class AURA_API UAuraEnemyPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//便捷获取（世界不支持本子系统时返回 nullptr）
+	static UAuraEnemyPool* Get(const UObject* WorldContextObject);
+
+	//取出（或新建）一个已激活并已被 AI 控制的敌人
+	AEnemyCharacter* AcquireEnemy(TSubclassOf<AEnemyCharacter> EnemyClass, const FTransform& SpawnTransform, int32 Level, ECharacterClass CharacterClass);
+
+	//停用并回收敌人（由 AEnemyCharacter::LifeSpanExpired 调用）
+	void ReleaseEnemy(AEnemyCharacter* Enemy);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	//每类最多缓存的空闲实例数
+	static constexpr int32 MaxPooledPerClass = 32;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FAuraEnemyPoolBucket> Buckets;
+};
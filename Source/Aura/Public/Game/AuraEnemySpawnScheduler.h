@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemySpawnScheduler.generated.h"
+
+class AAuraEnemySpawnPoint;
+
+/**
+ * 敌人分帧生成调度器（世界子系统）
+ *
+ * 功能说明：
+ * - 刷怪区域被触发时不再同一帧生成所有敌人，而是把生成请求放入队列；
+ * - 每帧在 SpawnBudgetMilliseconds 预算内按“离触发玩家由近到远”的顺序处理，预算用完留到下一帧；
+ * - 每帧至少处理一个请求，保证队列总能推进。
+ *
+ * 统计：stat AuraEnemySpawn（队列深度、单次生成耗时、每帧生成数）
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraEnemySpawnScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//便捷获取（世界不支持本子系统时返回 nullptr）
+	static UAuraEnemySpawnScheduler* Get(const UObject* WorldContextObject);
+
+	//加入生成请求：PriorityOrigin 一般为触发刷怪的玩家位置，离它越近越先生成
+	void QueueSpawn(AAuraEnemySpawnPoint* SpawnPoint, const FVector& PriorityOrigin);
+
+	//队列中待处理的请求数
+	int32 GetNumPendingSpawns() const { return PendingSpawns.Num(); }
+
+	/*FTickableGameObject*/
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !PendingSpawns.IsEmpty(); }
+	virtual TStatId GetStatId() const override;
+	/*End FTickableGameObject*/
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	//每帧用于生成敌人的时间预算（毫秒）
+	UPROPERTY(Config)
+	float SpawnBudgetMilliseconds = 2.f;
+
+private:
+	struct FPendingEnemySpawn
+	{
+		TWeakObjectPtr<AAuraEnemySpawnPoint> SpawnPoint;
+		//与触发点的距离平方（排序键）
+		double DistanceSquared = 0.0;
+		//入队序号：距离相同按入队顺序
+		uint32 Sequence = 0;
+	};
+
+	//按 (距离, 序号) 排列的小顶堆
+	TArray<FPendingEnemySpawn> PendingSpawns;
+	uint32 NextSequence = 0;
+
+	static bool IsHigherPriority(const FPendingEnemySpawn& A, const FPendingEnemySpawn& B);
+};
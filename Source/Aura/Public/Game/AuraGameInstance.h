@@ -3,9 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
 #include "Engine/GameInstance.h"
 #include "AuraGameInstance.generated.h"
 
+class ULoadScreenSaveGame;
+class USaveGame;
+
 /**
  * 
  */
@@ -23,5 +28,49 @@ public:
 
 	UPROPERTY()
 	int32 LoadSlotIndex;
-	
+
+	/*
+	 * 会话存档：本次游戏会话唯一的权威存档对象
+	 */
+
+	//获取当前槽位（LoadSlotName/LoadSlotIndex）的会话存档，首次访问时从磁盘读取一次，之后一直使用内存中的对象
+	ULoadScreenSaveGame* GetSessionSaveGame(TSubclassOf<USaveGame> SaveGameClass);
+
+	//请求提交会话存档：同一帧内的多次请求合并为一次写盘，下一帧在后台线程写入
+	void RequestSessionSave();
+
+	//丢弃内存中的会话存档（槽位被重建/删除后调用，下次访问重新从磁盘读取）
+	void ResetSessionSaveGame();
+
+	virtual void Shutdown() override;
+
+private:
+	UPROPERTY()
+	TObjectPtr<ULoadScreenSaveGame> SessionSaveGame;
+
+	//会话存档对应的槽位
+	FString SessionSlotName;
+	int32 SessionSlotIndex = INDEX_NONE;
+
+	//有尚未提交的修改
+	bool bSessionSaveRequested = false;
+	//后台写盘进行中（同一槽位的写入必须串行，进行中时新的请求等待其完成后再提交）
+	bool bSessionSaveInFlight = false;
+	//进行中的后台写盘任务（同步写入或读取槽位前需等待其完成）
+	FGraphEventRef SessionSaveTask;
+	//每次提交递增；回调只处理最近一次提交的结果，已被等待过的旧提交的迟到回调会被忽略
+	uint32 SessionSaveSerial = 0;
+
+	FTSTicker::FDelegateHandle SessionSaveTickerHandle;
+
+	//下一帧由 Ticker 调用，提交合并后的修改
+	bool TickSessionSave(float DeltaTime);
+
+	//把会话存档异步写入磁盘
+	void CommitSessionSave();
+
+	void OnSessionSaveFinished(const FString& SlotName, const int32 UserIndex, bool bSuccess, uint32 Serial);
+
+	//阻塞等待进行中的后台写盘完成（不会在等待期间处理游戏线程任务，因此不会重入提交）
+	void WaitForSessionSave();
 };
@@ -39,8 +39,8 @@ public:
 	//删除保存数据
 	static void DeleteSlot(const FString& SlotName, int32 SlotIndex);
 
-	//检索游戏保存数据
-	ULoadScreenSaveGame* RetrieveInGameSaveData();
+	//检索游戏保存数据（会话存档）
+	ULoadScreenSaveGame* RetrieveInGameSaveData() const;
 
 	//保存在游戏进度数据中
 	void SaveInGameProgressData(ULoadScreenSaveGame* SaveObject);
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraProjectilePool.generated.h"
+
+class AAuraProjectile;
+
+//同一投射物类的空闲实例
+USTRUCT()
+struct FAuraProjectilePoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraProjectile>> FreeProjectiles;
+};
+
+/**
+ * 投射物对象池（世界子系统，仅服务器使用）
+ *
+ * 功能说明：
+ * - 按投射物类分桶缓存已停用的投射物；命中/寿命到期时停用回收，而不是 Destroy；
+ * - 取用接口与 SpawnActorDeferred/FinishSpawning 对应：先取出实例并写入参数，再完成“生成”；
+ * - 停用的投射物隐藏、关闭碰撞并进入网络休眠，客户端保留同一个 Actor，重新激活时只同步状态，不再创建/销毁。
+ *
+ * 注意事项：
+ * - 被蓝图直接 Destroy 的池内实例会在取用时被跳过；
+ * - 每类最多缓存 MaxPooledPerClass 个，超出部分直接销毁。
+ */
+UCLASS()
+class AURA_API UAuraProjectilePool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//便捷获取（世界不支持本子系统时返回 nullptr）
+	static UAuraProjectilePool* Get(const UObject* WorldContextObject);
+
+	//取出（或新建）一个投射物，调用方写入参数后必须调用 FinishSpawningProjectile
+	AAuraProjectile* SpawnProjectileDeferred(TSubclassOf<AAuraProjectile> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator);
+
+	template<typename T>
+	T* SpawnProjectileDeferred(TSubclassOf<T> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+	{
+		return Cast<T>(SpawnProjectileDeferred(TSubclassOf<AAuraProjectile>(ProjectileClass), SpawnTransform, Owner, Instigator));
+	}
+
+	//完成生成：新建的实例走 FinishSpawning，复用的实例重新激活
+	void FinishSpawningProjectile(AAuraProjectile* Projectile, const FTransform& SpawnTransform);
+
+	//停用并回收投射物（由 AAuraProjectile::ReturnToPool 调用）
+	void ReleaseProjectile(AAuraProjectile* Projectile);
+
+	//预热：保证该类至少有 Count 个空闲实例
+	void PrewarmProjectiles(TSubclassOf<AAuraProjectile> ProjectileClass, int32 Count);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	//每类最多缓存的空闲实例数
+	static constexpr int32 MaxPooledPerClass = 64;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FAuraProjectilePoolBucket> Buckets;
+
+	AAuraProjectile* SpawnPooledProjectile(TSubclassOf<AAuraProjectile> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator, bool bStartActive);
+};
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+
+class ISaveGameSystem;
+class USaveGame;
+
+/**
+ * 存档文件格式版本
+ *
+ * 注意事项：
+ * - 修改文件布局或负载内容时在 VersionPlusOne 之前追加新版本，并在 FAuraSaveGameFormat::LoadFromMemory 中补充迁移；
+ * - 不带本格式文件头的旧存档（引擎默认的 SaveGameToSlot 格式）按 Legacy 处理，由引擎读取后在下次保存时写成新格式。
+ */
+enum class EAuraSaveFormatVersion : uint32
+{
+	Legacy = 0,
+	Initial = 1,
+
+	VersionPlusOne,
+	Latest = VersionPlusOne - 1
+};
+
+/**
+ * 存档读写（自定义二进制格式）
+ *
+ * 文件布局：
+ * - 文件头（不压缩）：Magic、格式版本、压缩算法、负载原始大小、负载 CRC32；
+ * - 负载（Oodle 压缩，不可用时回退为 Zlib/不压缩）：
+ *   引擎包版本与 CustomVersion（与引擎的 SaveGame 文件头一致，保证跨引擎版本的标签序列化可读）、存档类路径、
+ *   名称表、存档对象按属性标签（tagged property）序列化的数据（与引擎 SaveGameToMemory 相同，包含所有 UPROPERTY）。
+ *
+ * 功能说明：
+ * - 序列化时 FName、对象引用、软引用都写成名称表下标，属性名/GameplayTag/Actor 名等字符串在文件中只出现一次；
+ * - FSavedActor::Bytes 等 Actor 数据块随负载一起压缩；
+ * - 序列化在游戏线程完成（需要读取 UObject），压缩与写文件可在后台线程执行（AsyncSaveToSlot）。
+ */
+struct AURA_API FAuraSaveGameFormat
+{
+	//同步保存到槽位
+	static bool SaveToSlot(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex);
+
+	//游戏线程序列化后在后台线程压缩并写入槽位，完成后在游戏线程回调；返回后台写入任务（可等待其完成），序列化失败时返回空
+	static FGraphEventRef AsyncSaveToSlot(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex, TFunction<void(bool)> OnComplete);
+
+	//从槽位读取（自动识别旧格式）；文件不存在、校验失败或版本过新时返回 nullptr
+	static USaveGame* LoadFromSlot(const FString& SlotName, int32 UserIndex);
+
+	//内存形式（用于测量、迁移与自动化测试）
+	static bool SaveToMemory(USaveGame* SaveGame, TArray<uint8>& OutData);
+	static USaveGame* LoadFromMemory(const TArray<uint8>& Data);
+
+private:
+	//游戏线程：把存档对象序列化为未压缩的负载
+	static bool SerializePayload(USaveGame* SaveGame, TArray<uint8>& OutPayload);
+	//任意线程：压缩负载并加上文件头
+	static void EncodeFile(const TArray<uint8>& Payload, TArray<uint8>& OutData);
+	//任意线程：写入平台存档系统（SaveSystem 需在游戏线程获取）
+	static bool WriteSlot(ISaveGameSystem* SaveSystem, const FString& SlotName, int32 UserIndex, const TArray<uint8>& Data);
+};
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraSaveableActorRegistry.generated.h"
+
+/**
+ * 可保存 Actor 注册表（世界子系统）
+ *
+ * 功能说明：
+ * - 实现了 ISaveInterface 的 Actor 在 PostInitializeComponents 时注册、EndPlay 时注销；
+ * - SaveWorldState/LoadWorldState 只遍历这里登记的 Actor，而不是用 FActorIterator 扫描整个世界；
+ * - 记录哪些 Actor 的 SaveGame 属性自上次保存后被修改过（ISaveInterface::MarkSaveDirty），
+ *   SaveWorldState 只重新序列化这些 Actor，其余沿用存档中已有的字节数据。
+ *
+ * 注意事项：
+ * - 注册放在 PostInitializeComponents 而不是 BeginPlay：玩家角色在世界 BeginPlay 之前就被 Possess，
+ *   LoadWorldState 此时已经执行，关卡中放置的 Actor 必须在那之前完成注册；
+ * - 只在蓝图中实现 ISaveInterface 的类需要自行调用 RegisterSaveableActor/UnregisterSaveableActor；
+ * - 修改了 SaveGame 属性却没有标记为脏的 Actor 不会被重新保存（存档中还没有其记录时除外）。
+ */
+UCLASS()
+class AURA_API UAuraSaveableActorRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//便捷获取（世界不支持本子系统时返回 nullptr）
+	static UAuraSaveableActorRegistry* Get(const UObject* WorldContextObject);
+
+	//注册可保存 Actor（未实现 ISaveInterface 或重复注册会被忽略）
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void RegisterSaveableActor(AActor* Actor);
+	//注销（EndPlay）
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void UnregisterSaveableActor(AActor* Actor);
+
+	//已注册的 Actor（可能包含正在销毁的弱引用，使用前需检查有效性）
+	const TArray<TWeakObjectPtr<AActor>>& GetSaveableActors() const { return SaveableActors; }
+
+	//标记 Actor 需要在下次保存时重新序列化
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void MarkSaveableActorDirty(AActor* Actor);
+	//Actor 自上次保存后是否被标记为脏
+	bool IsSaveableActorDirty(const AActor* Actor) const { return DirtyActors.Contains(Actor); }
+	//保存完成后清除标记
+	void ClearSaveableActorDirty(const AActor* Actor) { DirtyActors.Remove(Actor); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	TArray<TWeakObjectPtr<AActor>> SaveableActors;
+
+	//自上次保存后被修改过的 Actor
+	TSet<TObjectKey<AActor>> DirtyActors;
+};
@@ -123,8 +123,22 @@ struct FSavedMap
 	FString MapAssetName = FString();
 
 	// 一个数组，包含了这个地图中所有被保存的 Actor 的数据。
+	// 增删元素请使用下面的接口，以保持按名称索引的一致性。
 	UPROPERTY()
 	TArray<FSavedActor> SavedActors;
+
+	// 按 Actor 名称查找已保存的数据，找不到时返回 nullptr（O(1)，不拷贝）
+	const FSavedActor* FindSavedActor(const FName& InActorName) const;
+	// 按 Actor 名称查找，不存在则追加一条新记录
+	FSavedActor& FindOrAddSavedActor(const FName& InActorName);
+	// 清空全部 Actor 记录
+	void ResetSavedActors();
+
+private:
+	// ActorName → SavedActors 下标（不参与序列化，首次查询时按数组重建）
+	mutable TMap<FName, int32> SavedActorIndex;
+
+	void ConditionalRebuildSavedActorIndex() const;
 };
 /**
  * 这是游戏的主要存档对象类，继承自 USaveGame。
@@ -205,10 +219,21 @@ public:
 	TArray<FSavedAbility> SavedAbilities;// 玩家当前拥有的所有技能的列表
 
 	UPROPERTY()
-	TArray<FSavedMap> SavedMaps; // 所有已探索并保存过的地图的状态列表
+	TArray<FSavedMap> SavedMaps; // 所有已探索并保存过的地图的状态列表（增删请使用 FindOrAddSavedMap）
 
-	// 根据地图名查找并返回地图的存档数据
+	// 根据地图名查找并返回地图的存档数据（按值返回整个地图，仅供需要副本的调用方使用）
 	FSavedMap GetSavedMapWithMapName(const FString& InMapName);
 	// 检查是否存在指定地图的存档数据
 	bool HasMap(const FString& InMapName);
+
+	// 根据地图名查找地图存档，找不到时返回 nullptr（O(1)，不拷贝）
+	const FSavedMap* FindSavedMap(const FString& InMapName) const;
+	// 根据地图名查找地图存档，不存在则追加一条新记录
+	FSavedMap& FindOrAddSavedMap(const FString& InMapName);
+
+private:
+	// MapAssetName → SavedMaps 下标（不参与序列化，首次查询时按数组重建）
+	mutable TMap<FName, int32> SavedMapIndex;
+
+	void ConditionalRebuildSavedMapIndex() const;
 };
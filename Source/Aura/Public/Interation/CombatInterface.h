@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AuraTeamTypes.h"
 #include "GameplayTagContainer.h"
 #include "GAS/Data/CharacterClassInfo.h"
 #include "UObject/Interface.h"
@@ -109,6 +110,8 @@ public:
 	virtual FOnDeathSignature& GetOnDeathSignatureDelegate() = 0;
 	//获得伤害值
 	virtual FOnDamageSignature& GetOnDamageSignature() = 0;
+	//获取阵营（纯 C++ 访问，敌我判定用）
+	virtual EAuraTeam GetTeam() const = 0;
 	
 	//设置在晕眩状态中
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable)
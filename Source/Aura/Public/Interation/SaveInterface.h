@@ -29,4 +29,7 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent)
 	//加载Actor
 	void LoadActor();
+
+	//标记 SaveGame 属性已修改：下次 SaveWorldState 时重新序列化本 Actor，未标记的 Actor 沿用上次保存的数据
+	void MarkSaveDirty();
 };
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "WorldCollision.h"
 #include "AuraPlayerController.generated.h"
 
 
@@ -17,6 +19,7 @@ class UAuraInputConfig;
 class AAuraHUD;
 class UInputMappingContext;
 class UInputAction;
+class UNavigationSystemV1;
 
  enum class ETargetingStatus : uint8
  {
@@ -55,6 +58,12 @@ public:
 	//隐藏魔法阵
 	UFUNCTION(BlueprintCallable)
 	void HideMagicCircle();
+
+	/*
+	 * 共享光标检测：同一帧、同一通道只检测一次（供 TargetDataUnderMouse 等复用）
+	 * bAllowDeltaGatedReuse 为 true 时，光标屏幕位置与相机视角均未变化且未超过刷新间隔的旧结果也可复用
+	 */
+	bool GetHitResultUnderCursorCached(ECollisionChannel TraceChannel, FHitResult& OutHitResult, bool bAllowDeltaGatedReuse = false);
 	
 protected:
 	virtual void BeginPlay() override;
@@ -86,6 +95,55 @@ private:
 	
 	//检查鼠标下演员
 	void CursorTrace();
+	//根据 CursorHit 更新高亮对象（仅在对象变化时调用高亮接口）
+	void UpdateHighlightFromCursorHit();
+	//CursorTrace（高亮）使用的检测通道：魔法阵显示时为 ECC_ExcludePlayers，否则为 ECC_Visibility
+	ECollisionChannel GetCursorTraceChannel() const;
+
+	//光标检测是否使用异步射线（结果延迟一帧生效）
+	UPROPERTY(EditDefaultsOnly, Category = "Input|CursorTrace")
+	bool bAsyncCursorTrace = false;
+
+	//光标与视角都未变化时，最长多久强制重新检测一次（秒；用于捕捉从光标下走过的移动目标）
+	UPROPERTY(EditDefaultsOnly, Category = "Input|CursorTrace")
+	float CursorTraceRefreshInterval = 0.1f;
+
+	//光标检测缓存的“视图键”：光标屏幕位置 + 相机位置/朝向/FOV
+	struct FCursorTraceViewKey
+	{
+		FVector2D MousePosition = FVector2D::ZeroVector;
+		FVector ViewLocation = FVector::ZeroVector;
+		FRotator ViewRotation = FRotator::ZeroRotator;
+		float FOV = 0.f;
+
+		bool Equals(const FCursorTraceViewKey& Other) const;
+	};
+
+	//单个通道的光标检测缓存
+	struct FCursorTraceCacheEntry
+	{
+		ECollisionChannel TraceChannel = ECC_Visibility;
+		FHitResult HitResult;
+		FCursorTraceViewKey ViewKey;
+		uint64 FrameNumber = 0;
+		double TraceTime = 0.0;
+	};
+	TArray<FCursorTraceCacheEntry, TInlineAllocator<3>> CursorTraceCache;
+
+	//取当前视图键（无本地玩家/鼠标时返回 false）
+	bool GetCursorTraceViewKey(FCursorTraceViewKey& OutViewKey) const;
+	//查找可复用的缓存结果
+	const FCursorTraceCacheEntry* FindReusableCursorTrace(ECollisionChannel TraceChannel, const FCursorTraceViewKey& ViewKey, bool bAllowDeltaGatedReuse) const;
+	//写入缓存
+	void StoreCursorTrace(ECollisionChannel TraceChannel, const FHitResult& HitResult, const FCursorTraceViewKey& ViewKey);
+
+	//异步光标检测
+	FTraceHandle PendingCursorTraceHandle;
+	ECollisionChannel PendingCursorTraceChannel = ECC_Visibility;
+	FCursorTraceViewKey PendingCursorTraceViewKey;
+	FTraceDelegate CursorTraceDelegate;
+	void RequestAsyncCursorTrace(ECollisionChannel TraceChannel, const FCursorTraceViewKey& ViewKey);
+	void OnAsyncCursorTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
  
 
 	TObjectPtr<AActor> LastActor;
@@ -134,6 +192,35 @@ private:
 	//自动移动
 	void AutoRun();
 
+	//自动行走：角色偏离当前跟随位置超过该距离时，回退为整条样条的全局最近点搜索
+	UPROPERTY(EditDefaultsOnly)
+	float AutoRunDeviationThreshold = 200.f;
+
+	//自动行走：当前跟随到的样条输入键（单调递增）
+	float AutoRunInputKey = 0.f;
+
+	//自动行走：推进样条输入键（只搜索当前段与下一段）
+	float AdvanceAutoRunInputKey(const FVector& PawnLocation);
+
+	//点击寻路：在同一目的地附近重复点击时复用/裁剪已有路径的判定半径
+	UPROPERTY(EditDefaultsOnly)
+	float PathReuseRadius = 100.f;
+
+	//当前点击寻路的路径点（世界坐标）
+	TArray<FVector> ClickToMovePathPoints;
+
+	//正在进行中的异步寻路查询 ID（INVALID_NAVQUERYID 表示没有）
+	uint32 PendingPathQueryId = INVALID_NAVQUERYID;
+
+	//发起点击寻路：优先复用已有路径，否则异步查询
+	void RequestClickToMovePath(const APawn* ControlledPawn);
+	//尝试复用并裁剪已有路径（新目的地在旧终点附近、角色仍在路径上，且替换后的最后一段在导航网格上畅通）
+	bool TryReuseClickToMovePath(const FVector& PawnLocation, UNavigationSystemV1& NavSys, const FNavAgentProperties& NavAgentProperties);
+	//异步寻路结果回调
+	void OnClickToMovePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath);
+	//把路径点写入样条并开始自动行走
+	void ApplyClickToMovePath();
+
 	//伤害组件
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UDamageTextComponent> DamageTextComponentClass;
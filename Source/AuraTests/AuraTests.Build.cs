@@ -0,0 +1,14 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+
+// 自动化测试模块：测试专用的 UCLASS 与需要生成 Actor/ASC 的测试放在这里，不进入 Runtime 模块与 Shipping 包
+public class AuraTests : ModuleRules
+{
+	public AuraTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "GameplayAbilities", "GameplayTags", "GameplayTasks", "Aura" });
+	}
+}
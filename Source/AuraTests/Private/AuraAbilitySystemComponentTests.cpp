@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraGamePlayTags.h"
+#include "AuraTestAbility.h"
+#include "AuraTestWorld.h"
+#include "GAS/AuraAbilitySystemComponent.h"
+
+namespace AuraAbilitySystemComponentTests
+{
+	// 测试世界：一个 Actor 挂一个已初始化 ActorInfo 的 ASC
+	struct FTestAbilityWorld : FAuraTestWorld
+	{
+		UAuraAbilitySystemComponent* AbilitySystemComponent = nullptr;
+
+		FTestAbilityWorld()
+			: FAuraTestWorld(TEXT("AuraAbilitySystemComponentTests"))
+		{
+			AbilitySystemComponent = SpawnAbilitySystemComponent();
+		}
+
+		/**
+		 * 授予 NumAbilities 个技能：前 NumAbilities - 1 个无标签、无槽位（Locked），
+		 * 最后一个为 UAuraTestAbility，绑定 Slot 并处于 Equipped，即旧线性扫描的最坏位置
+		 */
+		void GiveAbilities(int32 NumAbilities, const FGameplayTag& Slot) const
+		{
+			const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+			for (int32 Index = 0; Index < NumAbilities - 1; ++Index)
+			{
+				FGameplayAbilitySpec Spec(UAuraGameplayAbility::StaticClass(), 1);
+				Spec.GetDynamicSpecSourceTags().AddTag(GamePlayTags.Abilities_Status_Locked);
+				AbilitySystemComponent->GiveAbility(Spec);
+			}
+			FGameplayAbilitySpec Spec(UAuraTestAbility::StaticClass(), 1);
+			Spec.GetDynamicSpecSourceTags().AddTag(Slot);
+			Spec.GetDynamicSpecSourceTags().AddTag(GamePlayTags.Abilities_Status_Equipped);
+			AbilitySystemComponent->GiveAbility(Spec);
+		}
+	};
+
+	// 旧实现：GetSpecFromAbilityTag 的线性扫描（父子标签匹配）
+	FGameplayAbilitySpec* FindSpecFromAbilityTagLegacy(UAbilitySystemComponent& AbilitySystemComponent, const FGameplayTag& AbilityTag)
+	{
+		FScopedAbilityListLock ActiveScopeLock(AbilitySystemComponent);
+		for (FGameplayAbilitySpec& AbilitySpec : AbilitySystemComponent.GetActivatableAbilities())
+		{
+			for (const FGameplayTag& Tag : AbilitySpec.Ability->AbilityTags)
+			{
+				if (Tag.MatchesTag(AbilityTag))
+				{
+					return &AbilitySpec;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	// 旧实现：GetSpecWithSlot 的线性扫描
+	FGameplayAbilitySpec* FindSpecWithSlotLegacy(UAbilitySystemComponent& AbilitySystemComponent, const FGameplayTag& Slot)
+	{
+		FScopedAbilityListLock ActiveScopeLock(AbilitySystemComponent);
+		for (FGameplayAbilitySpec& AbilitySpec : AbilitySystemComponent.GetActivatableAbilities())
+		{
+			if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(Slot))
+			{
+				return &AbilitySpec;
+			}
+		}
+		return nullptr;
+	}
+}
+
+/**
+ * 技能规格索引与旧线性扫描的结果一致性，以及索引失效
+ *
+ * 功能说明：
+ * - 按技能标签、槽位查找（命中与未命中）与旧实现返回同一个 Spec，状态查询返回 Equipped；
+ * - ClearAbilitiesOfSlot 后槽位为空；重新分配槽位并 MarkAbilitySpecIndexDirty 后可再次查到；
+ * - GiveAbility 经 OnGiveAbility 自动使索引失效，新授予的槽位无需手动标脏即可查到。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAbilitySpecIndexTest, "Aura.GAS.AbilitySpecIndex",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraAbilitySpecIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraAbilitySystemComponentTests;
+
+	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	UAuraTestAbility::SetDefaultAbilityTag(GamePlayTags.Abilities_Fire_FireBolt);
+
+	FTestAbilityWorld TestWorld;
+	UAuraAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+	TestWorld.GiveAbilities(16, GamePlayTags.InputTag_4);
+
+	FGameplayAbilitySpec* Spec = ASC->GetSpecFromAbilityTag(GamePlayTags.Abilities_Fire_FireBolt);
+	TestNotNull(TEXT("Ability tag is indexed"), Spec);
+	TestTrue(TEXT("Ability tag lookup matches the linear scan"), Spec == FindSpecFromAbilityTagLegacy(*ASC, GamePlayTags.Abilities_Fire_FireBolt));
+	TestNull(TEXT("Missing ability tag"), ASC->GetSpecFromAbilityTag(GamePlayTags.Abilities_Fire_FireBlast));
+	TestTrue(TEXT("Slot lookup matches the linear scan"), ASC->GetSpecWithSlot(GamePlayTags.InputTag_4) == FindSpecWithSlotLegacy(*ASC, GamePlayTags.InputTag_4));
+	TestTrue(TEXT("Slot lookup returns the slotted spec"), ASC->GetSpecWithSlot(GamePlayTags.InputTag_4) == Spec);
+	TestTrue(TEXT("Unused slot is empty"), ASC->SlotIsEmpty(GamePlayTags.InputTag_5));
+	TestTrue(TEXT("Status comes from the spec's dynamic tags"),
+		ASC->GetStatusFromAbilityTag(GamePlayTags.Abilities_Fire_FireBolt) == GamePlayTags.Abilities_Status_Equipped);
+
+	ASC->ClearAbilitiesOfSlot(GamePlayTags.InputTag_4);
+	TestTrue(TEXT("Cleared slot is empty"), ASC->SlotIsEmpty(GamePlayTags.InputTag_4));
+
+	UAuraAbilitySystemComponent::AssignSlotToAbility(*Spec, GamePlayTags.InputTag_3);
+	ASC->MarkAbilitySpecIndexDirty();
+	TestTrue(TEXT("Reassigned slot is found after invalidation"), ASC->GetSpecWithSlot(GamePlayTags.InputTag_3) == Spec);
+
+	FGameplayAbilitySpec NewSpec(UAuraGameplayAbility::StaticClass(), 1);
+	NewSpec.GetDynamicSpecSourceTags().AddTag(GamePlayTags.InputTag_5);
+	const FGameplayAbilitySpecHandle NewHandle = ASC->GiveAbility(NewSpec);
+	const FGameplayAbilitySpec* FoundNewSpec = ASC->GetSpecWithSlot(GamePlayTags.InputTag_5);
+	TestTrue(TEXT("GiveAbility invalidates the index"), FoundNewSpec && FoundNewSpec->Handle == NewHandle);
+
+	return true;
+}
+
+/**
+ * 技能规格索引与旧线性扫描的查询耗时对比（8 / 64 个技能）
+ *
+ * 功能说明：
+ * - 被查找的技能位于列表末尾（旧实现的最坏情况），同时测一次命中与一次未命中的技能标签、槽位查询；
+ * - 耗时以 AddInfo 输出（纳秒/次），便于在 Session Frontend 中对比。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAbilitySpecIndexBenchmark, "Aura.GAS.AbilitySpecIndex.LookupBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAuraAbilitySpecIndexBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraAbilitySystemComponentTests;
+
+	constexpr int32 NumIterations = 20000;
+	const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+	UAuraTestAbility::SetDefaultAbilityTag(GamePlayTags.Abilities_Fire_FireBolt);
+
+	for (const int32 NumAbilities : { 8, 64 })
+	{
+		FTestAbilityWorld TestWorld;
+		UAuraAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		TestWorld.GiveAbilities(NumAbilities, GamePlayTags.InputTag_4);
+		// 预先建好索引，只测查询本身
+		ASC->GetSpecFromAbilityTag(GamePlayTags.Abilities_Fire_FireBolt);
+
+		int32 NumLegacyFound = 0;
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			NumLegacyFound += FindSpecFromAbilityTagLegacy(*ASC, GamePlayTags.Abilities_Fire_FireBolt) != nullptr;
+			NumLegacyFound += FindSpecFromAbilityTagLegacy(*ASC, GamePlayTags.Abilities_Fire_FireBlast) != nullptr;
+			NumLegacyFound += FindSpecWithSlotLegacy(*ASC, GamePlayTags.InputTag_4) != nullptr;
+			NumLegacyFound += FindSpecWithSlotLegacy(*ASC, GamePlayTags.InputTag_5) != nullptr;
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		int32 NumIndexedFound = 0;
+		const double IndexedStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			NumIndexedFound += ASC->GetSpecFromAbilityTag(GamePlayTags.Abilities_Fire_FireBolt) != nullptr;
+			NumIndexedFound += ASC->GetSpecFromAbilityTag(GamePlayTags.Abilities_Fire_FireBlast) != nullptr;
+			NumIndexedFound += ASC->GetSpecWithSlot(GamePlayTags.InputTag_4) != nullptr;
+			NumIndexedFound += ASC->GetSpecWithSlot(GamePlayTags.InputTag_5) != nullptr;
+		}
+		const double IndexedSeconds = FPlatformTime::Seconds() - IndexedStart;
+
+		TestEqual(FString::Printf(TEXT("%d abilities: same number of hits"), NumAbilities), NumIndexedFound, NumLegacyFound);
+
+		const double NumQueries = static_cast<double>(NumIterations * 4);
+		AddInfo(FString::Printf(TEXT("%d abilities: linear scan %.1f ns/query, index %.1f ns/query (%.1fx)"),
+			NumAbilities,
+			LegacySeconds * 1.e9 / NumQueries,
+			IndexedSeconds * 1.e9 / NumQueries,
+			IndexedSeconds > 0.0 ? LegacySeconds / IndexedSeconds : 0.0));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraTestCombatant.h"
+#include "AuraTestWorld.h"
+#include "Engine/OverlapResult.h"
+#include "Game/AuraCombatantRegistry.h"
+
+namespace AuraCombatantRegistryTests
+{
+	// 旧实现：GetLivePlayersWithinRadius 注册表之前的物理 Overlap 路径
+	void OverlapLiveCombatants(UWorld* World, const FVector& Origin, float Radius, TArray<AActor*>& OutActors)
+	{
+		TArray<FOverlapResult> Overlaps;
+		World->OverlapMultiByObjectType(
+			Overlaps,
+			Origin,
+			FQuat::Identity,
+			FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects),
+			FCollisionShape::MakeSphere(Radius),
+			FCollisionQueryParams());
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			AActor* OverlapActor = Overlap.GetActor();
+			if (OverlapActor && OverlapActor->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(OverlapActor))
+			{
+				OutActors.AddUnique(OverlapActor);
+			}
+		}
+	}
+
+	// 两边结果不一致且不在球面边界 1 厘米以内的单位数
+	int32 CountMismatches(const TArray<AActor*>& RegistryActors, const TArray<AActor*>& OverlapActors, const FVector& Origin, float Radius)
+	{
+		int32 NumMismatches = 0;
+		auto CountMissing = [&](const TArray<AActor*>& From, const TArray<AActor*>& In)
+		{
+			for (AActor* Actor : From)
+			{
+				if (In.Contains(Actor)) continue;
+				const float Distance = FVector::Dist(Origin, Actor->GetActorLocation());
+				if (!FMath::IsNearlyEqual(Distance, Radius + Actor->GetSimpleCollisionRadius(), 1.f))
+				{
+					++NumMismatches;
+				}
+			}
+		};
+		CountMissing(RegistryActors, OverlapActors);
+		CountMissing(OverlapActors, RegistryActors);
+		return NumMismatches;
+	}
+}
+
+/**
+ * 注册表半径查询与物理 Overlap 的对比（50 / 200 / 1000 个单位）
+ *
+ * 功能说明：
+ * - 在空的游戏世界中于 20000x20000 的区域内随机生成单位，分别用旧的 Overlap 路径与注册表做同样的 500 半径查询；
+ * - 结果集合必须一致（球面边界上的浮点差异除外），耗时以 AddInfo 输出，便于在 Session Frontend 中对比。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraCombatantRegistryBenchmark, "Aura.Game.CombatantRegistry.RadiusQueryBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAuraCombatantRegistryBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraCombatantRegistryTests;
+
+	constexpr float HalfExtent = 10000.f;
+	constexpr float QueryRadius = 500.f;
+	constexpr int32 NumQueries = 256;
+	constexpr int32 NumPasses = 8;
+
+	for (const int32 NumCombatants : { 50, 200, 1000 })
+	{
+		const FAuraTestWorld TestWorld(TEXT("AuraCombatantRegistryBenchmark"));
+		UWorld* World = TestWorld.World;
+
+		UAuraCombatantRegistry* Registry = World->GetSubsystem<UAuraCombatantRegistry>();
+		if (!TestNotNull(TEXT("Registry exists in a game world"), Registry)) return false;
+
+		FRandomStream Random(NumCombatants);
+		for (int32 Index = 0; Index < NumCombatants; ++Index)
+		{
+			const FVector Location(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f);
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			AAuraTestCombatant* Combatant = World->SpawnActor<AAuraTestCombatant>(Location, FRotator::ZeroRotator, SpawnParams);
+			Registry->RegisterCombatant(Combatant);
+		}
+		TestEqual(TEXT("All combatants registered"), Registry->GetNumCombatants(), NumCombatants);
+
+		// 让物理场景完成一次同步，保证新生成的碰撞体可被场景查询命中
+		World->Tick(LEVELTICK_All, 1.f / 60.f);
+
+		TArray<FVector> Origins;
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			Origins.Emplace(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f);
+		}
+
+		int32 NumMismatches = 0;
+		TArray<AActor*> OverlapActors;
+		TArray<AActor*> RegistryActors;
+		const TArray<AActor*> ActorsToIgnore;
+		for (const FVector& Origin : Origins)
+		{
+			OverlapActors.Reset();
+			RegistryActors.Reset();
+			OverlapLiveCombatants(World, Origin, QueryRadius, OverlapActors);
+			Registry->GetCombatantsInRadius(Origin, QueryRadius, RegistryActors, ActorsToIgnore);
+			NumMismatches += CountMismatches(RegistryActors, OverlapActors, Origin, QueryRadius);
+		}
+		TestEqual(FString::Printf(TEXT("%d combatants: registry matches overlap"), NumCombatants), NumMismatches, 0);
+
+		const double OverlapStart = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (const FVector& Origin : Origins)
+			{
+				OverlapActors.Reset();
+				OverlapLiveCombatants(World, Origin, QueryRadius, OverlapActors);
+			}
+		}
+		const double OverlapSeconds = FPlatformTime::Seconds() - OverlapStart;
+
+		const double RegistryStart = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (const FVector& Origin : Origins)
+			{
+				RegistryActors.Reset();
+				Registry->GetCombatantsInRadius(Origin, QueryRadius, RegistryActors, ActorsToIgnore);
+			}
+		}
+		const double RegistrySeconds = FPlatformTime::Seconds() - RegistryStart;
+
+		const double NumTotalQueries = static_cast<double>(NumQueries * NumPasses);
+		AddInfo(FString::Printf(TEXT("%d combatants: overlap %.2f us/query, registry %.2f us/query (%.1fx)"),
+			NumCombatants,
+			OverlapSeconds * 1.e6 / NumTotalQueries,
+			RegistrySeconds * 1.e6 / NumTotalQueries,
+			RegistrySeconds > 0.0 ? OverlapSeconds / RegistrySeconds : 0.0));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraGamePlayTags.h"
+#include "AuraTestWorld.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectExecutionCalculation.h"
+#include "GAS/AuraAttributeSet.h"
+#include "GAS/ExecCalc/ExecCalc_Damage.h"
+
+namespace AuraDamageTypeTests
+{
+	/**
+	 * 伤害执行测试世界：来源与目标各一个挂有 UAuraAttributeSet 的 ASC，外加一个只含 UExecCalc_Damage 的瞬时 GE
+	 *
+	 * 注意事项：
+	 * - 测试世界没有 Aura GameMode，取不到职业信息，伤害计算系数按 0 处理；
+	 * - 属性值固定，命中结果只受 Debuff/格挡/暴击的随机判定影响。
+	 */
+	struct FDamageExecutionWorld : FAuraTestWorld
+	{
+		UAuraAbilitySystemComponent* SourceAbilitySystemComponent = nullptr;
+		UAuraAbilitySystemComponent* TargetAbilitySystemComponent = nullptr;
+		UGameplayEffect* DamageEffect = nullptr;
+
+		FDamageExecutionWorld()
+			: FAuraTestWorld(TEXT("AuraDamageExecutionTests"))
+		{
+			SourceAbilitySystemComponent = SpawnAbilitySystemComponentWithAttributes();
+			TargetAbilitySystemComponent = SpawnAbilitySystemComponentWithAttributes();
+
+			SourceAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetArmorPenetrionAttribute(), 10.f);
+			SourceAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetCriticalHitChanceAttribute(), 25.f);
+			SourceAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetCriticalHitDamageAttribute(), 5.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetArmorAttribute(), 20.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetBlockChanceAttribute(), 15.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetFireResistanceAttribute(), 10.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetLightningResistanceAttribute(), 20.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetArcaneResistanceAttribute(), 30.f);
+			TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetPhysicalResistanceAttribute(), 40.f);
+
+			DamageEffect = NewObject<UGameplayEffect>(GetTransientPackage(), TEXT("GE_AuraDamageExecutionTest"));
+			DamageEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+			FGameplayEffectExecutionDefinition Execution;
+			Execution.CalculationClass = UExecCalc_Damage::StaticClass();
+			DamageEffect->Executions.Add(Execution);
+		}
+
+		UAuraAbilitySystemComponent* SpawnAbilitySystemComponentWithAttributes() const
+		{
+			UAuraAbilitySystemComponent* AbilitySystemComponent = SpawnAbilitySystemComponent();
+			AbilitySystemComponent->AddSpawnedAttribute(NewObject<UAuraAttributeSet>(AbilitySystemComponent->GetOwner()));
+			return AbilitySystemComponent;
+		}
+
+		// 构造一次命中的 Spec：只含一种伤害类型，附带 Debuff 参数，并像 GE 应用时一样捕获目标属性
+		TSharedRef<FGameplayEffectSpec> MakeHitSpec(const FGameplayTag& DamageType) const
+		{
+			const FAuraGamePlayTags& GamePlayTags = FAuraGamePlayTags::Get();
+			TSharedRef<FGameplayEffectSpec> Spec = MakeShared<FGameplayEffectSpec>(DamageEffect, SourceAbilitySystemComponent->MakeEffectContext(), 1.f);
+			Spec->SetSetByCallerMagnitude(DamageType, 20.f);
+			Spec->SetSetByCallerMagnitude(GamePlayTags.Debuff_Chance, 20.f);
+			Spec->SetSetByCallerMagnitude(GamePlayTags.Debuff_Damage, 5.f);
+			Spec->SetSetByCallerMagnitude(GamePlayTags.Debuff_Duration, 5.f);
+			Spec->SetSetByCallerMagnitude(GamePlayTags.Debuff_Frequency, 1.f);
+			Spec->CaptureAttributeDataFromTarget(TargetAbilitySystemComponent);
+			return Spec;
+		}
+	};
+}
+
+/**
+ * 伤害类型信息表与旧映射表的一致性
+ *
+ * 功能说明：
+ * - DamageTypeInfos 的每一项必须与 DamageTypesToResistance / DamageTypesToDebuffs 给出相同的抗性与 Debuff；
+ * - 两张映射表的项数与信息表一致（新增伤害类型时漏填任一处都会失败）；
+ * - GetDamageTypeIndex 能把每个伤害类型映射回自身下标，未知标签返回 INDEX_NONE。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraDamageTypeTableTest, "Aura.GAS.DamageTypeTable",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraDamageTypeTableTest::RunTest(const FString& Parameters)
+{
+	const FAuraGamePlayTags& Tags = FAuraGamePlayTags::Get();
+
+	TestEqual(TEXT("Resistance map covers every damage type"), Tags.DamageTypesToResistance.Num(), static_cast<int32>(EAuraDamageTypeIndex::Num));
+	TestEqual(TEXT("Debuff map covers every damage type"), Tags.DamageTypesToDebuffs.Num(), static_cast<int32>(EAuraDamageTypeIndex::Num));
+
+	for (int32 DamageTypeIndex = 0; DamageTypeIndex < EAuraDamageTypeIndex::Num; ++DamageTypeIndex)
+	{
+		const FAuraDamageTypeInfo& Info = Tags.DamageTypeInfos[DamageTypeIndex];
+		const FString DamageTypeName = Info.DamageType.ToString();
+
+		const FGameplayTag* Resistance = Tags.DamageTypesToResistance.Find(Info.DamageType);
+		const FGameplayTag* Debuff = Tags.DamageTypesToDebuffs.Find(Info.DamageType);
+		TestTrue(FString::Printf(TEXT("%s resistance matches"), *DamageTypeName), Resistance && *Resistance == Info.Resistance);
+		TestTrue(FString::Printf(TEXT("%s debuff matches"), *DamageTypeName), Debuff && *Debuff == Info.Debuff);
+		TestEqual(FString::Printf(TEXT("%s index round trip"), *DamageTypeName), Tags.GetDamageTypeIndex(Info.DamageType), DamageTypeIndex);
+	}
+	TestEqual(TEXT("Unknown damage type"), Tags.GetDamageTypeIndex(Tags.Debuff_Burn), static_cast<int32>(INDEX_NONE));
+	return true;
+}
+
+/**
+ * 伤害执行计算（UExecCalc_Damage::Execute_Implementation）的吞吐
+ *
+ * 功能说明：
+ * - 在测试世界中用真实的 Spec 与目标 ASC 执行伤害计算，四种伤害类型轮换，每次命中只含一种类型；
+ * - Spec 与目标属性捕获预先建好，只计执行本身；每次执行必须输出一个 IncomingDamage 的正值修改器；
+ * - 吞吐以 AddInfo 输出（次命中/秒与纳秒/次命中）。
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraDamageExecutionBenchmark, "Aura.GAS.DamageTypeTable.ExecutionBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAuraDamageExecutionBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraDamageTypeTests;
+
+	constexpr int32 NumHits = 20000;
+	const FAuraGamePlayTags& Tags = FAuraGamePlayTags::Get();
+	const FDamageExecutionWorld TestWorld;
+	const UExecCalc_Damage* ExecCalc = GetDefault<UExecCalc_Damage>();
+
+	TArray<TSharedRef<FGameplayEffectSpec>, TInlineAllocator<EAuraDamageTypeIndex::Num>> HitSpecs;
+	TArray<TUniquePtr<FGameplayEffectCustomExecutionParameters>, TInlineAllocator<EAuraDamageTypeIndex::Num>> ExecutionParams;
+	const TArray<FGameplayEffectExecutionScopedModifierInfo> NoScopedModifiers;
+	for (int32 DamageTypeIndex = 0; DamageTypeIndex < EAuraDamageTypeIndex::Num; ++DamageTypeIndex)
+	{
+		TSharedRef<FGameplayEffectSpec> Spec = TestWorld.MakeHitSpec(Tags.DamageTypeInfos[DamageTypeIndex].DamageType);
+		ExecutionParams.Add(MakeUnique<FGameplayEffectCustomExecutionParameters>(*Spec, NoScopedModifiers, TestWorld.TargetAbilitySystemComponent, FGameplayTagContainer(), FPredictionKey()));
+		HitSpecs.Add(MoveTemp(Spec));
+	}
+
+	int32 NumDamagingHits = 0;
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Hit = 0; Hit < NumHits; ++Hit)
+	{
+		FGameplayEffectCustomExecutionOutput Output;
+		ExecCalc->Execute_Implementation(*ExecutionParams[Hit % EAuraDamageTypeIndex::Num], Output);
+		const TArray<FGameplayModifierEvaluatedData>& Modifiers = Output.GetOutputModifiers();
+		NumDamagingHits += Modifiers.Num() == 1
+			&& Modifiers[0].Attribute == UAuraAttributeSet::GetIncomingDamageAttribute()
+			&& Modifiers[0].Magnitude > 0.f;
+	}
+	const double Seconds = FPlatformTime::Seconds() - Start;
+
+	TestEqual(TEXT("Every execution outputs positive incoming damage"), NumDamagingHits, NumHits);
+
+	AddInfo(FString::Printf(TEXT("UExecCalc_Damage: %.0f hits/sec (%.1f ns/hit)"),
+		Seconds > 0.0 ? NumHits / Seconds : 0.0,
+		Seconds * 1.e9 / NumHits));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GAS/Ability/AuraGameplayAbility.h"
+#include "AuraTestAbility.generated.h"
+
+/**
+ * 自动化测试用的技能类
+ *
+ * 功能说明：
+ * - 技能标签写在 CDO 上（与蓝图技能一致，ASC 通过 Spec.Ability->AbilityTags 读取）；
+ * - 原生标签在 CDO 构造时尚未注册，因此由测试在运行时调用 SetDefaultAbilityTag 写入；
+ * - 位于 AuraTests 测试模块（DeveloperTool），不会进入 Runtime 模块与 Shipping 包。
+ */
+UCLASS(NotBlueprintable, HideDropdown, Transient)
+class UAuraTestAbility : public UAuraGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	static void SetDefaultAbilityTag(const FGameplayTag& AbilityTag)
+	{
+		UAuraTestAbility* DefaultAbility = GetMutableDefault<UAuraTestAbility>();
+		DefaultAbility->AbilityTags.Reset();
+		DefaultAbility->AbilityTags.AddTag(AbilityTag);
+	}
+};
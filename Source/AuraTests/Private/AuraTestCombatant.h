@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/Actor.h"
+#include "Interation/CombatInterface.h"
+#include "AuraTestCombatant.generated.h"
+
+/**
+ * 自动化测试用的最小战斗单位
+ *
+ * 功能说明：
+ * - 只有一个球形碰撞体（WorldDynamic，仅查询），既能被 UAuraCombatantRegistry 注册，也能被旧的 Overlap 查询命中；
+ * - 不带 ASC、网格体与 AI，用于在空世界中大量生成做性能对比；
+ * - 位于 AuraTests 测试模块（DeveloperTool），不会进入 Runtime 模块与 Shipping 包。
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown, Transient)
+class AAuraTestCombatant : public AActor, public ICombatInterface
+{
+	GENERATED_BODY()
+
+public:
+	AAuraTestCombatant()
+	{
+		Sphere = CreateDefaultSubobject<USphereComponent>("Sphere");
+		Sphere->InitSphereRadius(40.f);
+		Sphere->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+		SetRootComponent(Sphere);
+	}
+
+	/** Combat 接口函数*/
+	virtual bool IsDead_Implementation() const override { return false; }
+	virtual void Die(const FVector& DeathImpulse) override {}
+	virtual FOnASCRegistered& GetOnASCRegisteredDelegate() override { return OnAscRegistered; }
+	virtual FOnDeathSignature& GetOnDeathSignatureDelegate() override { return OnDeath; }
+	virtual FOnDamageSignature& GetOnDamageSignature() override { return OnDamage; }
+	virtual EAuraTeam GetTeam() const override { return EAuraTeam::Enemy; }
+	/** 结束Combat 接口函数*/
+
+private:
+	UPROPERTY()
+	TObjectPtr<USphereComponent> Sphere;
+
+	FOnASCRegistered OnAscRegistered;
+	FOnDeathSignature OnDeath;
+	FOnDamageSignature OnDamage;
+};
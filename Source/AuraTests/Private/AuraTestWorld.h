@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GAS/AuraAbilitySystemComponent.h"
+
+/**
+ * 自动化测试用的临时游戏世界
+ *
+ * 功能说明：
+ * - 构造时创建 Game 类型的世界、注册 WorldContext 并 BeginPlay，析构时注销并销毁；
+ * - 需要生成 Actor、世界子系统或 ASC 的测试共用这一份创建/清理逻辑。
+ */
+struct FAuraTestWorld
+{
+	UWorld* World = nullptr;
+
+	explicit FAuraTestWorld(const TCHAR* WorldName)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, WorldName);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FAuraTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FAuraTestWorld(const FAuraTestWorld&) = delete;
+	FAuraTestWorld& operator=(const FAuraTestWorld&) = delete;
+
+	// 生成一个挂有 ASC 的 Actor（Owner 与 Avatar 均为该 Actor，ActorInfo 已初始化）
+	UAuraAbilitySystemComponent* SpawnAbilitySystemComponent() const
+	{
+		AActor* Owner = World->SpawnActor<AActor>();
+		UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Owner);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Owner, Owner);
+		return AbilitySystemComponent;
+	}
+};